@@ -17,6 +17,8 @@
 #include <SFML/Graphics.hpp>
 #include <unordered_map>
 #include <memory>
+#include <string>
+#include <vector>
 #include "../Include/DebugWindow/DebugWindow.h"
 #include "../Include/PlayerClass/Player.h"
 #include "../Include/LoggingSystem/DebugWindow/DebugWindowLogger.h"
@@ -50,6 +52,33 @@ namespace KryptosEngine {
              */
             std::unordered_map<GameObject*, bool> expandedState;
 
+            /**
+             * Name labels, indexed by NameId. Each label is built once, the first time an
+             * object with that name is drawn, so names are not copied every frame.
+             */
+            std::vector<sf::String> nameLabels;
+
+            /**
+             * @brief Detail labels of an expanded object, as of the change version they were built at.
+             */
+            struct DetailLabels {
+                GameObjectHandle handle;    ///< Object the labels were built for.
+                std::uint32_t version = 0;  ///< Change version of the object when the labels were built.
+                sf::String position;        ///< Position label.
+                sf::String rotation;        ///< Rotation label.
+                sf::String mass;            ///< Mass label.
+                sf::String gravity;         ///< Gravity flag label.
+                std::vector<std::string> probeValues; ///< Last formatted value of each debug probe.
+                std::vector<sf::Text> probeTexts;     ///< Text of each debug probe, restrung only when its value changes.
+            };
+
+            std::string probeLabel; ///< Scratch buffer for building debug probe labels.
+
+            /**
+             * Detail labels of each expanded object, rebuilt only when the object has changed.
+             */
+            std::unordered_map<GameObject*, DetailLabels> detailLabels;
+
             sf::Font defaultFont; ///< Default font used for rendering text in the debug window.
 
         public:
@@ -0,0 +1,408 @@
+/*
+ * EventBus.h - Kryptos Typed Event Bus
+ * ------------------------------------
+ * Defines the EventBus, which lets game objects and systems notify each
+ * other through typed events instead of calling each other directly.
+ * Events are queued in one ring buffer per event type and delivered to
+ * subscribers in batches at fixed points of the frame.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - memory: For owning the event queues and their ring buffers.
+ *   - atomic: For reserving ring buffer entries from several threads.
+ *   - functional: For subscriber callbacks.
+ *   - vector, string: For queue storage and display names.
+ *   - typeinfo: For the event types' display names.
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace KryptosEngine {
+
+    /**
+     * @brief Points of the frame at which queued events are delivered.
+     */
+    enum class EventStage : std::uint8_t {
+        PostUpdate,   ///< After GameObjectManager::updateAll.
+        PostPhysics,  ///< After the physics and scene graph passes.
+        EndOfFrame,   ///< After rendering, before the frame's changes are cleared.
+        Count         ///< Number of stages.
+    };
+
+    /**
+     * @class EventQueueBase
+     * @brief Type-independent part of an event queue: its stage and statistics.
+     */
+    class EventQueueBase {
+    protected:
+        /**
+         * @brief Sequence number returned by reserve when the event was dropped.
+         */
+        static constexpr std::uint64_t Dropped = ~std::uint64_t(0);
+
+        std::string typeName;                       ///< Display name of the event type.
+        EventStage stage;                           ///< Stage at which the events are delivered.
+        std::size_t capacity;                       ///< Size of the ring buffer, a power of two.
+        std::atomic<std::uint64_t> writeCount{ 0 }; ///< Number of entries reserved, including dropped ones.
+        std::uint64_t readCount = 0;                ///< Number of entries delivered.
+        std::atomic<std::uint64_t> droppedCount{ 0 }; ///< Events dropped because the queue was full.
+        std::size_t lastBatchSize = 0;              ///< Number of events delivered by the last dispatch.
+        std::size_t highWaterMark = 0;              ///< Largest batch delivered at once.
+        std::uint64_t deliveredCount = 0;           ///< Events delivered since the queue was created.
+
+        /**
+         * @brief Reserves a ring buffer entry for a new event.
+         * @return Sequence number of the entry, or Dropped if the queue is full.
+         */
+        std::uint64_t reserve() {
+            const std::uint64_t sequence = writeCount.fetch_add(1, std::memory_order_relaxed);
+            if (sequence - readCount >= capacity) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return Dropped;
+            }
+            return sequence;
+        }
+
+        /**
+         * @brief Forgets entries reserved past the end of the ring buffer.
+         *
+         * Every entry below readCount + capacity was written; every entry past it was dropped.
+         * Trimming before readCount moves keeps dropped reservations from leaving unwritten
+         * gaps once the buffer has room again.
+         */
+        void trim() {
+            const std::uint64_t written = writeCount.load(std::memory_order_relaxed);
+            if (written - readCount > capacity) {
+                writeCount.store(readCount + capacity, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructs an empty queue.
+         * @param typeName Display name of the event type, shown in the debug window.
+         * @param stage Stage at which the events are delivered.
+         * @param capacity Number of events the queue holds; rounded up to a power of two.
+         */
+        EventQueueBase(const std::string& typeName, EventStage stage, std::size_t capacity);
+
+        virtual ~EventQueueBase() = default;
+        EventQueueBase(const EventQueueBase&) = delete;
+        EventQueueBase& operator=(const EventQueueBase&) = delete;
+
+        /**
+         * @brief Delivers every queued event to the subscribers, then empties the queue.
+         */
+        virtual void dispatch() = 0;
+
+        /**
+         * @brief Discards every queued event without delivering it.
+         */
+        void clear() {
+            trim();
+            readCount = writeCount.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the display name of the event type.
+         */
+        const std::string& getTypeName() const {
+            return typeName;
+        }
+
+        /**
+         * @brief Gets the stage at which the events are delivered.
+         */
+        EventStage getStage() const {
+            return stage;
+        }
+
+        /**
+         * @brief Gets the number of events the queue holds.
+         */
+        std::size_t getCapacity() const {
+            return capacity;
+        }
+
+        /**
+         * @brief Gets the number of events delivered by the last dispatch.
+         */
+        std::size_t getLastBatchSize() const {
+            return lastBatchSize;
+        }
+
+        /**
+         * @brief Gets the largest number of events delivered by one dispatch.
+         */
+        std::size_t getHighWaterMark() const {
+            return highWaterMark;
+        }
+
+        /**
+         * @brief Gets the number of events delivered since the queue was created.
+         */
+        std::uint64_t getDeliveredCount() const {
+            return deliveredCount;
+        }
+
+        /**
+         * @brief Gets the number of events dropped because the queue was full.
+         */
+        std::uint64_t getDroppedCount() const {
+            return droppedCount.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @class EventQueue
+     * @brief Ring buffer of events of one type, with the subscribers that receive them.
+     *
+     * The ring buffer is allocated once, so publishing never allocates. Any number of threads
+     * may publish at once, for example from object updates running on the JobSystem, but not
+     * while the queue is being dispatched from another thread. Subscribers receive the batch
+     * as at most two contiguous arrays, split only where the batch wraps around the buffer.
+     * @tparam T The event type; must be trivially copyable and default constructible.
+     */
+    template <typename T>
+    class EventQueue final : public EventQueueBase {
+    public:
+        /**
+         * @brief Function receiving a contiguous run of events.
+         */
+        using Subscriber = std::function<void(const T* events, std::size_t count)>;
+
+    private:
+        std::unique_ptr<T[]> events;                                   ///< Ring buffer entries.
+        std::vector<std::pair<std::uint32_t, Subscriber>> subscribers; ///< Subscribers with their IDs, in subscription order.
+
+    public:
+        /**
+         * @brief Constructs an empty queue and allocates its ring buffer.
+         * @param stage Stage at which the events are delivered.
+         * @param capacity Number of events the queue holds; rounded up to a power of two.
+         */
+        EventQueue(EventStage stage, std::size_t capacity)
+            : EventQueueBase(typeid(T).name(), stage, capacity),
+            events(std::make_unique<T[]>(this->capacity)) {
+        }
+
+        /**
+         * @brief Queues an event. Safe from several threads at once; never allocates.
+         * @param event The event.
+         * @return False if the queue was full and the event was dropped.
+         */
+        bool publish(const T& event) {
+            const std::uint64_t sequence = reserve();
+            if (sequence == Dropped) {
+                return false;
+            }
+            events[sequence & (capacity - 1)] = event;
+            return true;
+        }
+
+        /**
+         * @brief Adds a subscriber.
+         * @param id ID identifying the subscription.
+         * @param subscriber Function receiving each batch.
+         */
+        void subscribe(std::uint32_t id, Subscriber subscriber) {
+            subscribers.emplace_back(id, std::move(subscriber));
+        }
+
+        /**
+         * @brief Removes a subscriber.
+         * @param id ID the subscriber was added with.
+         * @return True if the subscriber was found.
+         */
+        bool unsubscribe(std::uint32_t id) {
+            for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+                if (it->first == id) {
+                    subscribers.erase(it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Delivers every queued event to the subscribers, then empties the queue.
+         *
+         * Events published by subscribers while the batch is delivered are queued behind it
+         * and delivered by the next dispatch.
+         */
+        void dispatch() override {
+            trim();
+            const std::uint64_t begin = readCount;
+            const std::uint64_t end = writeCount.load(std::memory_order_acquire);
+            const std::size_t count = static_cast<std::size_t>(end - begin);
+
+            lastBatchSize = count;
+            highWaterMark = std::max(highWaterMark, count);
+            deliveredCount += count;
+            if (count == 0) {
+                return;
+            }
+
+            const std::size_t first = static_cast<std::size_t>(begin & (capacity - 1));
+            const std::size_t firstCount = std::min(count, capacity - first);
+            for (std::size_t i = 0; i < subscribers.size(); ++i) {
+                subscribers[i].second(events.get() + first, firstCount);
+                if (firstCount < count) {
+                    subscribers[i].second(events.get(), count - firstCount);
+                }
+            }
+
+            trim();
+            readCount = end;
+        }
+    };
+
+    /**
+     * @class EventBus
+     * @brief Singleton owning one EventQueue per event type.
+     *
+     * Event types are registered up front with the stage at which they are delivered and the
+     * number of events a frame may queue. The game loop calls dispatch once per stage, which
+     * delivers every queue of that stage in registration order. Registration, subscription and
+     * dispatch happen on the main thread; publishing is safe from any thread outside dispatch.
+     */
+    class EventBus {
+    private:
+        std::vector<std::unique_ptr<EventQueueBase>> queues; ///< Queues, in registration order.
+        std::uint32_t nextSubscriptionId = 1;                 ///< ID given to the next subscription.
+
+        /**
+         * @brief Private constructor for Singleton pattern.
+         */
+        EventBus() = default;
+
+        /**
+         * @brief Gets the slot caching the queue of an event type.
+         *
+         * One slot per type avoids a map lookup on every publish.
+         */
+        template <typename T>
+        static EventQueue<T>*& queueSlot() {
+            static EventQueue<T>* queue = nullptr;
+            return queue;
+        }
+
+        /**
+         * @brief Gets the queue of a registered event type.
+         * @throw std::logic_error if the type was not registered.
+         */
+        template <typename T>
+        static EventQueue<T>& queueOf() {
+            EventQueue<T>* queue = queueSlot<T>();
+            if (queue == nullptr) {
+                throw std::logic_error(std::string("Event type ") + typeid(T).name() + " is not registered with the EventBus");
+            }
+            return *queue;
+        }
+
+    public:
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        /**
+         * @brief Gets the singleton instance of the EventBus.
+         * @return Reference to the singleton instance.
+         */
+        static EventBus& getInstance();
+
+        /**
+         * @brief Creates the queue for an event type. Registering a type again does nothing.
+         * @tparam T The event type; must be trivially copyable.
+         * @param stage Stage at which the events are delivered.
+         * @param capacity Number of events that can be queued between two dispatches.
+         */
+        template <typename T>
+        void registerEventType(EventStage stage, std::size_t capacity = 1024) {
+            static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+                "events must be trivially copyable and default constructible");
+            if (queueSlot<T>() != nullptr) {
+                return;
+            }
+            auto queue = std::make_unique<EventQueue<T>>(stage, capacity);
+            queueSlot<T>() = queue.get();
+            queues.push_back(std::move(queue));
+        }
+
+        /**
+         * @brief Queues an event for delivery at its type's stage.
+         *
+         * Safe from several threads at once, such as object updates running on the JobSystem,
+         * but not during dispatch on another thread. Never allocates.
+         * @tparam T A registered event type.
+         * @param event The event.
+         * @return False if the queue was full and the event was dropped.
+         * @throw std::logic_error if the type was not registered.
+         */
+        template <typename T>
+        bool publish(const T& event) {
+            return queueOf<T>().publish(event);
+        }
+
+        /**
+         * @brief Adds a function receiving every batch of events of a type.
+         *
+         * The function is called with contiguous runs of events; a batch that wraps around the
+         * ring buffer arrives as two runs.
+         * @tparam T A registered event type.
+         * @param subscriber Function taking a pointer to the first event and the number of events.
+         * @return ID of the subscription, for unsubscribe.
+         * @throw std::logic_error if the type was not registered.
+         */
+        template <typename T>
+        std::uint32_t subscribe(typename EventQueue<T>::Subscriber subscriber) {
+            const std::uint32_t id = nextSubscriptionId++;
+            queueOf<T>().subscribe(id, std::move(subscriber));
+            return id;
+        }
+
+        /**
+         * @brief Removes a subscription. Must not be called by a subscriber of the same type.
+         * @tparam T The event type the subscription was made for.
+         * @param id ID returned by subscribe.
+         * @return True if the subscription was found.
+         */
+        template <typename T>
+        bool unsubscribe(std::uint32_t id) {
+            EventQueue<T>* queue = queueSlot<T>();
+            return queue != nullptr && queue->unsubscribe(id);
+        }
+
+        /**
+         * @brief Delivers the queued events of every type belonging to a stage.
+         * @param stage The stage the game loop has reached.
+         */
+        void dispatch(EventStage stage);
+
+        /**
+         * @brief Discards every queued event of every type, for example after a rewind.
+         */
+        void clear();
+
+        /**
+         * @brief Gets every event queue, in registration order.
+         */
+        const std::vector<std::unique_ptr<EventQueueBase>>& getQueues() const {
+            return queues;
+        }
+    };
+
+} // namespace KryptosEngine
@@ -0,0 +1,201 @@
+/*
+ * CommandBuffer.h - Kryptos Deferred Structural Commands
+ * ------------------------------------------------------
+ * Defines the CommandBuffer class, which records object spawns and
+ * destructions made while the object list is being iterated so the
+ * GameObjectManager can apply them together at a sync point.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - GameObjectHandle.h: Destroy commands refer to objects by handle.
+ *   - vector, memory: For command lists and payload storage blocks.
+ */
+
+#pragma once
+#include "GameObjectHandle.h"
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @struct CommandOrder
+ * @brief Position of a command in the order the GameObjectManager applies commands in.
+ *
+ * Commands are applied by source, then by recording order within the source, so the order
+ * does not depend on which thread happened to record them.
+ */
+struct CommandOrder {
+    std::uint64_t source;    ///< Update position of the code that recorded the command; 0 outside updates.
+    std::uint32_t sequence;  ///< Recording order within the buffer.
+
+    bool operator<(const CommandOrder& other) const {
+        return source != other.source ? source < other.source : sequence < other.sequence;
+    }
+};
+
+ /**
+  * @class CommandBuffer
+  * @brief Single-threaded buffer of deferred spawn and destroy commands.
+  *
+  * The GameObjectManager keeps one buffer per JobSystem thread, so recording never takes
+  * a lock. Spawn commands are stored as callables placed in reusable storage blocks; the
+  * blocks are kept after a flush, so a steady frame-to-frame workload stops allocating.
+  * Every command carries a CommandOrder, so the commands of all buffers can be merged into
+  * one deterministic order.
+  */
+class CommandBuffer {
+private:
+    /**
+     * @brief A recorded destroy.
+     */
+    struct DestroyCommand {
+        GameObjectHandle handle;        ///< The object to destroy.
+        CommandOrder order;             ///< Position in the merged order.
+    };
+
+    /**
+     * @brief A recorded spawn: a type-erased callable living in a storage block.
+     */
+    struct SpawnCommand {
+        void (*execute)(void* payload); ///< Invokes the callable.
+        void (*destroy)(void* payload); ///< Destroys the callable, or nullptr once executed.
+        void* payload;                  ///< The callable.
+        CommandOrder order;             ///< Position in the merged order.
+    };
+
+    /**
+     * @brief Size of a payload storage block. Larger payloads get a block of their own.
+     */
+    static constexpr std::size_t BlockSize = 4096;
+
+    std::vector<DestroyCommand> destroys;               ///< Objects to destroy, in recording order.
+    std::vector<SpawnCommand> spawns;                   ///< Spawns to run, in recording order.
+    std::vector<std::unique_ptr<std::byte[]>> blocks;   ///< Payload storage; block 0.. are BlockSize bytes.
+    std::vector<std::unique_ptr<std::byte[]>> oversized; ///< Storage for payloads larger than a block.
+    std::size_t currentBlock = 0;                       ///< Block payloads are currently placed in.
+    std::size_t blockOffset = 0;                        ///< First free byte in the current block.
+    std::uint64_t source = 0;                           ///< Source given to commands recorded now.
+    std::uint32_t nextSequence = 0;                     ///< Sequence given to the next command.
+
+    /**
+     * @brief Reserves aligned payload storage.
+     * @param size Size of the payload, in bytes.
+     * @param alignment Alignment of the payload, at most the default new alignment.
+     * @return Pointer to the storage.
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief Gets the order of the next recorded command.
+     */
+    CommandOrder nextOrder() {
+        return { source, nextSequence++ };
+    }
+
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer();
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    /**
+     * @brief Records a callable that creates an object when the buffer is executed.
+     * @param function A callable taking no arguments.
+     */
+    template <typename Function>
+    void recordSpawn(Function&& function) {
+        using Payload = std::decay_t<Function>;
+        static_assert(alignof(Payload) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "spawn arguments are over-aligned");
+
+        void* payload = ::new (allocate(sizeof(Payload), alignof(Payload))) Payload(std::forward<Function>(function));
+        spawns.push_back({
+            [](void* p) { (*static_cast<Payload*>(p))(); },
+            [](void* p) { static_cast<Payload*>(p)->~Payload(); },
+            payload,
+            nextOrder() });
+    }
+
+    /**
+     * @brief Records an object to destroy when the buffer is executed.
+     * @param handle The object's handle.
+     */
+    void recordDestroy(GameObjectHandle handle) {
+        destroys.push_back({ handle, nextOrder() });
+    }
+
+    /**
+     * @brief Sets the source of the commands recorded from now on.
+     * @param commandSource Position of the recording code in the update order; 0 outside updates.
+     */
+    void setSource(std::uint64_t commandSource) {
+        source = commandSource;
+    }
+
+    /**
+     * @brief Checks whether the buffer holds any commands.
+     * @return True if nothing is recorded.
+     */
+    bool empty() const {
+        return destroys.empty() && spawns.empty();
+    }
+
+    /**
+     * @brief Gets the number of recorded destroys.
+     */
+    std::size_t getDestroyCount() const {
+        return destroys.size();
+    }
+
+    /**
+     * @brief Gets a recorded destroy's object.
+     * @param index Index of the destroy, in recording order.
+     */
+    GameObjectHandle getDestroyHandle(std::size_t index) const {
+        return destroys[index].handle;
+    }
+
+    /**
+     * @brief Gets a recorded destroy's position in the merged order.
+     * @param index Index of the destroy, in recording order.
+     */
+    CommandOrder getDestroyOrder(std::size_t index) const {
+        return destroys[index].order;
+    }
+
+    /**
+     * @brief Gets the number of recorded spawns.
+     */
+    std::size_t getSpawnCount() const {
+        return spawns.size();
+    }
+
+    /**
+     * @brief Gets a recorded spawn's position in the merged order.
+     * @param index Index of the spawn, in recording order.
+     */
+    CommandOrder getSpawnOrder(std::size_t index) const {
+        return spawns[index].order;
+    }
+
+    /**
+     * @brief Runs one recorded spawn and destroys its callable.
+     *
+     * The buffer must not record while its spawns are being run; the GameObjectManager
+     * swaps in another buffer first.
+     * @param index Index of the spawn, in recording order. Each spawn runs at most once.
+     */
+    void executeSpawn(std::size_t index);
+
+    /**
+     * @brief Drops every command, destroying the callables of spawns that never ran.
+     *
+     * Storage blocks are kept for reuse, and the source and sequence start over.
+     */
+    void clear();
+};
@@ -0,0 +1,151 @@
+/*
+ * ComponentQuery.h - Kryptos Component Layouts
+ * --------------------------------------------
+ * Describes which components each game object type holds, so the
+ * GameObjectManager can answer queries such as "every object with a
+ * SpriteRenderer" per update bucket instead of per object.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - tuple, utility: For walking a type's component member list at compile time.
+ *   - vector: For the accessors of a layout.
+ *   - cstdint: For component type IDs and masks.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class GameObject;
+
+/**
+ * @brief Set of component types, one bit per component type ID.
+ */
+using ComponentMask = std::uint64_t;
+
+/**
+ * @brief Number of distinct component types a program may use.
+ */
+constexpr std::uint32_t MaxComponentTypes = 64;
+
+/**
+ * @brief Assigns the next component type ID.
+ * @return A new ID below MaxComponentTypes.
+ * @throw std::length_error if every ID is taken.
+ */
+std::uint32_t nextComponentTypeId();
+
+/**
+ * @brief Gets the ID of a component type, assigning one on first use.
+ * @tparam C The component type.
+ * @return The type's ID, the same for the whole run.
+ */
+template <typename C>
+std::uint32_t componentTypeId() {
+    static const std::uint32_t id = nextComponentTypeId();
+    return id;
+}
+
+/**
+ * @brief Gets the mask of a set of component types.
+ * @tparam Components The component types.
+ * @return A mask with one bit set per type.
+ */
+template <typename... Components>
+ComponentMask componentMaskOf() {
+    static const ComponentMask mask = (ComponentMask(0) | ... | (ComponentMask(1) << componentTypeId<Components>()));
+    return mask;
+}
+
+/**
+ * @brief Finds a component of one concrete game object type.
+ */
+struct ComponentAccessor {
+    std::uint32_t typeId;             ///< ID of the component type.
+    void* (*get)(GameObject* object); ///< Returns the component of an object of the concrete type.
+};
+
+/**
+ * @struct ComponentLayout
+ * @brief Components held by every object of one concrete game object type.
+ *
+ * Types declare their components with a public static constexpr tuple of pointers to the
+ * component members, named Components:
+ *
+ *     static constexpr auto Components = std::make_tuple(&Player::spriteRenderer);
+ *
+ * The tuple is read when the type is registered with the GameObjectManager, so which types
+ * hold which components is fixed at compile time and never checked per object.
+ */
+struct ComponentLayout {
+    ComponentMask mask = 0;                   ///< Component types the type holds.
+    std::vector<ComponentAccessor> accessors; ///< Accessor of each component, in declaration order.
+
+    /**
+     * @brief Finds the accessor of a component type.
+     * @param typeId ID of the component type.
+     * @return The accessor's function, or nullptr if the type does not hold the component.
+     */
+    void* (*find(std::uint32_t typeId) const)(GameObject*) {
+        for (const ComponentAccessor& accessor : accessors) {
+            if (accessor.typeId == typeId) {
+                return accessor.get;
+            }
+        }
+        return nullptr;
+    }
+};
+
+namespace ComponentDetail {
+    /**
+     * @brief True for types declaring a Components tuple.
+     */
+    template <typename T, typename = void>
+    struct HasComponents : std::false_type {};
+
+    template <typename T>
+    struct HasComponents<T, std::void_t<decltype(T::Components)>> : std::true_type {};
+
+    /**
+     * @brief Type of the component a type's I-th component member refers to.
+     */
+    template <typename T, std::size_t I>
+    using ComponentAt = std::remove_reference_t<decltype(std::declval<T&>().*std::get<I>(T::Components))>;
+
+    /**
+     * @brief Returns the I-th component of an object whose concrete type is T.
+     */
+    template <typename T, std::size_t I>
+    void* componentOf(GameObject* object) {
+        return &(static_cast<T*>(object)->*std::get<I>(T::Components));
+    }
+
+    /**
+     * @brief Adds an accessor for each of a type's component members to a layout.
+     */
+    template <typename T, std::size_t... I>
+    void describe(ComponentLayout& layout, std::index_sequence<I...>) {
+        ((layout.mask |= ComponentMask(1) << componentTypeId<ComponentAt<T, I>>(),
+            layout.accessors.push_back({ componentTypeId<ComponentAt<T, I>>(), &componentOf<T, I> })), ...);
+    }
+}
+
+/**
+ * @brief Builds the component layout of a concrete game object type.
+ * @tparam T The concrete type; types without a Components tuple get an empty layout.
+ * @return The layout.
+ */
+template <typename T>
+ComponentLayout componentLayoutOf() {
+    ComponentLayout layout;
+    if constexpr (ComponentDetail::HasComponents<T>::value) {
+        ComponentDetail::describe<T>(layout, std::make_index_sequence<std::tuple_size_v<std::decay_t<decltype(T::Components)>>>());
+    }
+    return layout;
+}
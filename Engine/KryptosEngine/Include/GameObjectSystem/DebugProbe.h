@@ -0,0 +1,168 @@
+/*
+ * DebugProbe.h - Kryptos Debug Value Probes
+ * -----------------------------------------
+ * Defines debug probes: typed descriptions of a game object member that the
+ * debug window can display. A probe records the member's name, its byte
+ * offset inside the object and its type, so one table of probes describes
+ * every instance of a type and values are formatted without allocating.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - unordered_set: Probe names are stored once, apart from object names.
+ *   - typeindex: Probe tables are shared per concrete type.
+ *   - mutex: Guards table creation against concurrent construction.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+ /**
+  * @brief Type of the value a probe reads.
+  */
+enum class DebugValueType : std::uint8_t {
+    Bool,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double
+};
+
+/**
+ * @brief Gets the DebugValueType of a supported C++ type.
+ * @tparam T bool, a 32- or 64-bit integer, float or double.
+ */
+template <typename T>
+constexpr DebugValueType debugValueTypeOf() {
+    using U = std::remove_cv_t<T>;
+    static_assert(std::is_same_v<U, bool> || std::is_same_v<U, float> || std::is_same_v<U, double> ||
+        (std::is_integral_v<U> && (sizeof(U) == 4 || sizeof(U) == 8)),
+        "debug probes support bool, 32- and 64-bit integers, float and double");
+
+    if constexpr (std::is_same_v<U, bool>) {
+        return DebugValueType::Bool;
+    }
+    else if constexpr (std::is_same_v<U, float>) {
+        return DebugValueType::Float;
+    }
+    else if constexpr (std::is_same_v<U, double>) {
+        return DebugValueType::Double;
+    }
+    else if constexpr (sizeof(U) == 4) {
+        return std::is_signed_v<U> ? DebugValueType::Int32 : DebugValueType::UInt32;
+    }
+    else {
+        return std::is_signed_v<U> ? DebugValueType::Int64 : DebugValueType::UInt64;
+    }
+}
+
+/**
+ * @struct DebugProbe
+ * @brief A displayable member of a game object type.
+ */
+struct DebugProbe {
+    std::string_view name;  ///< Display name, stored by the DebugProbeRegistry.
+    std::int32_t offset;    ///< Byte offset of the member from the object's GameObject base.
+    DebugValueType type;    ///< Type of the member.
+
+    /**
+     * @brief Formats the probed member of an object.
+     *
+     * Writes at most `size` bytes, including the terminator, and never allocates.
+     * @param object Address of the object's GameObject base.
+     * @param buffer Receives the text.
+     * @param size Size of the buffer.
+     * @return The length of the text, truncated to fit the buffer.
+     */
+    std::size_t format(const void* object, char* buffer, std::size_t size) const;
+};
+
+/**
+ * @struct DebugProbeTable
+ * @brief The probes of one game object type, its base types' probes first.
+ */
+struct DebugProbeTable {
+    std::type_index objectType;     ///< Type whose constructor registered the last probes.
+    std::vector<DebugProbe> probes; ///< Probes in registration order.
+};
+
+/**
+ * @struct StagedDebugProbe
+ * @brief A probe registered by an object under construction, before its type has a table.
+ */
+struct StagedDebugProbe {
+    std::type_index objectType;  ///< Type whose constructor registered the probe.
+    std::string name;            ///< Display name of the member.
+    DebugValueType valueType;    ///< Type of the member.
+    std::ptrdiff_t offset;       ///< Byte offset of the member from the object's GameObject base.
+};
+
+/**
+ * @class DebugProbeRegistry
+ * @brief Singleton owning the probe table of every game object type.
+ *
+ * Each type's table is built once, from the probes staged by the first instance constructed,
+ * and never changes afterwards. Later instances find the table and register nothing. Probe
+ * names are kept in their own table, so they never enter the NameTable of object names.
+ */
+class DebugProbeRegistry {
+private:
+    std::deque<DebugProbeTable> tables;                            ///< Probe tables; deque elements never move or change.
+    std::unordered_map<std::type_index, const DebugProbeTable*> tableByType; ///< Table of each type that has one.
+    std::unordered_set<std::string> names;                         ///< Probe names; set elements never move.
+    std::mutex mutex;                                              ///< Guards the tables and names.
+
+    /**
+     * @brief Private constructor to enforce singleton pattern.
+     */
+    DebugProbeRegistry() = default;
+
+public:
+    DebugProbeRegistry(const DebugProbeRegistry&) = delete;
+    DebugProbeRegistry& operator=(const DebugProbeRegistry&) = delete;
+
+    /**
+     * @brief Provides access to the singleton instance of DebugProbeRegistry.
+     * @return A reference to the singleton instance.
+     */
+    static DebugProbeRegistry& getInstance() {
+        static DebugProbeRegistry instance;
+        return instance;
+    }
+
+    /**
+     * @brief Gets the table of a type, if one was published.
+     *
+     * Found tables are cached per thread, so after a thread's first lookup of a type this
+     * takes no lock.
+     * @param objectType The type.
+     * @return The type's table, or nullptr if none was published yet.
+     */
+    const DebugProbeTable* find(std::type_index objectType);
+
+    /**
+     * @brief Publishes the tables of the types whose probes an object staged during construction.
+     *
+     * The staged probes hold one run per constructor, base types first. Each run whose type has
+     * no table yet becomes that type's table, starting from the previous type's entries; a type
+     * that already has one, published meanwhile by another instance, keeps it. Probes named
+     * like an earlier entry of the same table are ignored.
+     * @param inherited The table the object had found before it staged its first probe, or nullptr.
+     * @param staged The staged probes, in registration order.
+     * @return The table of the last staged type, valid for the program's lifetime.
+     */
+    const DebugProbeTable* publish(const DebugProbeTable* inherited, const std::vector<StagedDebugProbe>& staged);
+};
@@ -3,17 +3,42 @@
  * ----------------------------------------
  * Defines the base GameObject class used to represent entities in the game.
  * Supports properties such as position, rotation, mass, and debug tracking.
+ * Transform and physics properties are stored in the GameObjectManager's
+ * TransformStore, and the active state is the object's partition in the
+ * manager; the accessors here are views into them.
  *
  * Author: Sam Camilleri, Mural Studios
  * All Rights Reserved, 2025.
  */
 
 #pragma once
+#include "GameObjectHandle.h"
+#include "NameTable.h"
+#include "DebugProbe.h"
 #include <SFML/Graphics.hpp>
 #include <string>
-#include <unordered_map>
-#include <functional>
-#include <type_traits>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct ChangeFlags
+ * @brief Bits recording which parts of an object changed during the current frame.
+ *
+ * Set by the GameObject setters and by engine systems that write the TransformStore, and
+ * cleared by GameObjectManager::clearChanges at the end of each frame.
+ */
+struct ChangeFlags {
+    static constexpr std::uint8_t Position = 1 << 0; ///< Position changed.
+    static constexpr std::uint8_t Rotation = 1 << 1; ///< Rotation changed.
+    static constexpr std::uint8_t Velocity = 1 << 2; ///< Velocity changed.
+    static constexpr std::uint8_t Physics = 1 << 3;  ///< Mass or gravity flag changed.
+    static constexpr std::uint8_t Active = 1 << 4;   ///< Object was activated or deactivated.
+    static constexpr std::uint8_t Created = 1 << 5;  ///< Object was registered this frame.
+};
+
+struct PendingRegistration;
 
  /**
   * @class GameObject
@@ -21,40 +46,50 @@
   *
   * Represents an entity in the game world with properties such as position,
   * rotation, mass, and whether it uses gravity. Supports debug-tracked variables.
+  * Game objects are identified by their registry handle and cannot be copied.
+  *
+  * The object itself holds only its vtable pointer, handle and, for objects constructed off
+  * the main thread, its pending registration. Per-frame fields live in the
+  * manager's TransformStore, and the name and debug probes live in the manager's cold table,
+  * keyed by handle.
   */
 class GameObject {
 private:
+    friend class GameObjectManager;
+
+    GameObjectHandle handle;  ///< Registry handle assigned by the GameObjectManager.
+    PendingRegistration* registration = nullptr; ///< Registration made off the main thread, or nullptr.
+
     /**
-     * @brief Stores debug-tracked variables and their associated getter functions.
+     * @brief Adds a probe to this object's type, unless its type already has a probe table.
+     * @param name The display name of the variable.
+     * @param type The type of the variable.
+     * @param offset Byte offset of the variable from this object.
+     * @throw std::invalid_argument if the offset cannot belong to a member of this object.
      */
-    std::unordered_map<std::string, std::function<std::string()>> debugTrackedValues;
+    void registerDebugProbe(std::string_view name, DebugValueType type, std::ptrdiff_t offset);
 
-protected:
-    std::string name;         ///< Name of the game object.
-    sf::Vector2f position;    ///< Position of the object in the game world.
-    sf::Angle rotation;       ///< Rotation of the object in the game world.
-    bool active;              ///< Indicates whether the object is active.
-    float mass;               ///< Mass of the object, used for physics calculations.
-    bool useGravity;          ///< Indicates whether the object is affected by gravity.
+    /**
+     * @brief Gets this object's index into the TransformStore columns.
+     * @return The dense index of the object in the GameObjectManager.
+     */
+    std::uint32_t transformIndex() const;
 
+protected:
     /**
      * @brief Registers a variable for debugging.
      *
-     * Tracks the value of a variable for display in the debug interface.
-     * @tparam T The type of the variable to register.
+     * Tracks the value of a variable for display in the debug interface. The variable is
+     * recorded by its offset inside the object, so it must be a data member of this object;
+     * the probe table is built by the first instance of a type and shared by the rest.
+     * @tparam T bool, a 32- or 64-bit integer, float or double.
      * @param name The name of the variable.
-     * @param variable The variable to track.
+     * @param variable The member variable to track.
      */
     template <typename T>
-    void registerDebugVariable(const std::string& name, T& variable) {
-        debugTrackedValues[name] = [&variable]() -> std::string {
-            if constexpr (std::is_same_v<T, bool>) {
-                return variable ? "true" : "false";
-            }
-            else {
-                return std::to_string(variable);
-            }
-            };
+    void registerDebugVariable(std::string_view name, const T& variable) {
+        registerDebugProbe(name, debugValueTypeOf<T>(),
+            reinterpret_cast<const char*>(&variable) - reinterpret_cast<const char*>(this));
     }
 
 public:
@@ -80,21 +115,71 @@ public:
      */
     virtual ~GameObject();
 
+    GameObject(const GameObject&) = delete;
+    GameObject& operator=(const GameObject&) = delete;
+
     /**
-     * @brief Retrieves debug-tracked variables.
-     * @return A map of variable names and their getter functions.
+     * @brief Updates the object's logic.
+     *
+     * Called once per frame by GameObjectManager::updateAll, possibly on a worker thread.
+     * See GameObjectManager::updateAll for what an update may access. Does nothing by default.
+     * @param deltaTime Time elapsed since the last frame.
      */
-    const std::unordered_map<std::string, std::function<std::string()>>& getDebugTrackedValues() const{
-        return debugTrackedValues;
-	}
+    virtual void update(float deltaTime);
+
+    /**
+     * @brief Called on the main thread once the object is fully constructed and registered.
+     *
+     * A constructor run off the main thread by GameObjectManager::create has no handle yet and
+     * must not touch shared engine state, so setup that needs either, such as adding colliders
+     * or loading textures, belongs here. Called by spawn, create and submit, and by
+     * GameObjectManager::publishRegistrations for objects constructed on other threads.
+     * Does nothing by default.
+     */
+    virtual void onRegistered();
+
+    /**
+     * @brief Retrieves the debug probes of this object's type.
+     * @return The probes, in registration order; empty if none were registered.
+     */
+    const std::vector<DebugProbe>& getDebugProbes() const;
+
+    /**
+     * @brief Formats the current value of one of this object's debug probes.
+     *
+     * Does not allocate; the text is truncated to fit the buffer.
+     * @param probe A probe from getDebugProbes().
+     * @param buffer Receives the text.
+     * @param size Size of the buffer.
+     * @return The length of the text.
+     */
+    std::size_t formatDebugValue(const DebugProbe& probe, char* buffer, std::size_t size) const {
+        return probe.format(this, buffer, size);
+    }
 
     // Getters
-    std::string getName() const;
+    GameObjectHandle getHandle() const;
+    std::string_view getName() const;
+    NameId getNameId() const;
     sf::Vector2f getPosition() const;
     bool isActive() const;
     float getMass() const;
     bool getUseGravity() const;
     sf::Angle getRotation() const;
+    sf::Vector2f getVelocity() const;
+
+    /**
+     * @brief Gets the parts of this object that changed during the current frame.
+     * @return A combination of ChangeFlags bits, or zero if nothing changed.
+     */
+    std::uint8_t getChangeFlags() const;
+
+    /**
+     * @brief Checks whether any of the given parts changed during the current frame.
+     * @param flags A combination of ChangeFlags bits.
+     * @return True if at least one of the bits is set.
+     */
+    bool hasChanged(std::uint8_t flags) const;
 
     // Setters
     void setPosition(const sf::Vector2f& newPosition);
@@ -102,4 +187,16 @@ public:
     void setMass(float newMass);
     void setUseGravity(bool state);
     void setRotation(const sf::Angle& newRotation);
+    void setVelocity(const sf::Vector2f& newVelocity);
+
+    /**
+     * @brief Applies a force to the object until the next physics update.
+     *
+     * Forces accumulate and are divided by the object's mass when integrated.
+     * Objects with a mass of zero or less ignore forces.
+     * @param force The force to apply.
+     */
+    void addForce(const sf::Vector2f& force);
 };
+
+static_assert(sizeof(GameObject) <= 64, "GameObject must fit in one cache line; keep rarely used data in the manager's cold table");
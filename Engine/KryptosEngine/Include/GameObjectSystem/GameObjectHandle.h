@@ -0,0 +1,48 @@
+/*
+ * GameObjectHandle.h - Kryptos Game Object Handle
+ * -----------------------------------------------
+ * Defines the generational handle used to refer to game objects registered
+ * with the GameObjectManager. A handle pairs a slot index with the generation
+ * of that slot, so handles to destroyed objects can be detected as stale.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - cstdint: For fixed-width index and generation types.
+ */
+
+#pragma once
+#include <cstdint>
+
+ /**
+  * @struct GameObjectHandle
+  * @brief Generational reference to a registered game object.
+  *
+  * The index selects a slot in the GameObjectManager's registry, and the generation
+  * must match the slot's current generation for the handle to resolve.
+  */
+struct GameObjectHandle {
+    static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu; ///< Index value used by null handles.
+
+    std::uint32_t index = InvalidIndex; ///< Slot index within the registry.
+    std::uint32_t generation = 0;       ///< Generation of the slot when the handle was issued.
+
+    /**
+     * @brief Checks whether the handle refers to a slot at all.
+     * @return True if the handle has a slot index, false for a null handle.
+     *
+     * A non-null handle may still be stale; use GameObjectManager::isValid to check liveness.
+     */
+    bool isNull() const {
+        return index == InvalidIndex;
+    }
+
+    bool operator==(const GameObjectHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const GameObjectHandle& other) const {
+        return !(*this == other);
+    }
+};
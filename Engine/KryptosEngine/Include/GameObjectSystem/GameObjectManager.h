@@ -8,16 +8,114 @@
  * Author: Sam Camilleri, Mural Studios
  * All Rights Reserved, 2025.
  *
+ * Objects live in a generational slot map: registration and unregistration
+ * are O(1), and handles to destroyed objects are detected as stale. Live
+ * objects are packed in a dense array, active objects first, with their
+ * transform and physics fields in a TransformStore kept in the same order
+ * and their names and debug probes in a cold table indexed by slot.
+ *
+ * Each frame, updateAll updates the active objects in parallel on the
+ * JobSystem, one update bucket per registered type, so each type is updated
+ * by a devirtualized loop. Objects far from a focus object, such as the
+ * player, can tick every second, fourth or eighth frame instead. Spawns and
+ * destructions requested during the updates are recorded in per-thread
+ * CommandBuffers and applied in a deterministic order once they finish.
+ * Objects created or destroyed on other threads, such as level streaming
+ * threads, reach the main thread through a lock-free queue and take effect
+ * at the next frame boundary.
+ *
+ * The manager also keeps per-type ObjectPools for objects created with
+ * spawn, an index of interned names for findByName and findAllByPrefix, and
+ * an optional SpatialIndex in sync with object positions. Changes to each
+ * object are recorded as ChangeFlags and listed per frame, so downstream
+ * systems work in proportion to what changed. view finds the objects
+ * holding a set of components by matching whole buckets against component
+ * layouts fixed at compile time.
+ *
  * Dependencies:
  *   - GameObject.h: Base class for game objects.
- *   - vector: For storing game object pointers.
- *   - algorithm: For handling object removal.
+ *   - GameObjectHandle.h: Generational handles issued by the registry.
+ *   - TransformStore.h: Structure-of-arrays storage for object transforms.
+ *   - SpatialIndex.h: Spatial index kept in sync with object positions.
+ *   - ObjectPool.h: Block pools backing spawned objects.
+ *   - CommandBuffer.h: Per-thread buffers of deferred spawns and destructions.
+ *   - MpscQueue.h: Lock-free queue of registrations made off the main thread.
+ *   - ComponentQuery.h: Component layouts of object types, for view.
+ *   - JobSystem.h: Runs parallel iteration of component views.
+ *   - vector: For storing slots and the dense object array.
+ *   - unordered_map, typeindex: For mapping concrete types to update buckets.
+ *   - cstdint: For slot index types.
  */
 
 #pragma once
 #include "GameObject.h"
-#include <vector>
+#include "GameObjectHandle.h"
+#include "TransformStore.h"
+#include "ObjectPool.h"
+#include "CommandBuffer.h"
+#include "MpscQueue.h"
+#include "ComponentQuery.h"
+#include "../JobSystem/JobSystem.h"
+#include "../SpatialSystem/SpatialIndex.h"
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+#include <typeindex>
+#include <typeinfo>
+#include <type_traits>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+ /**
+  * @struct PendingRegistration
+  * @brief A registration or destruction requested off the main thread, waiting for the frame boundary.
+  *
+  * A registration node holds the constructor's initial state until the object is published.
+  * The name is kept raw and only interned by the main thread when it publishes the object,
+  * so constructing off the main thread takes no lock. Debug probes are staged the same way,
+  * unless the object's type already has a probe table.
+  * The node is owned by the object, except once cancelled, when the main thread frees it. A
+  * destruction node is allocated by the destroying thread, which returns at once; the main
+  * thread deletes the object and frees the node.
+  */
+struct PendingRegistration {
+    /**
+     * @brief Progress of the node.
+     */
+    enum class State : std::uint8_t {
+        Staged,       ///< Object under construction; not yet queued.
+        Queued,       ///< Object fully constructed and waiting to be published.
+        Publishing,   ///< Main thread registering the object.
+        Published,    ///< Object registered by the main thread.
+        Cancelled,    ///< Object destroyed before it was published.
+        Destroy       ///< Published object to be deleted by the main thread.
+    };
+
+    PendingRegistration* next = nullptr;                 ///< Link used by the MpscQueue.
+    std::atomic<State> state{ State::Staged };           ///< Progress of the node.
+    GameObject* object = nullptr;                        ///< Object to register or destroy.
+    std::string name;                                    ///< Name of the object, not yet interned.
+    sf::Vector2f position;                               ///< Initial position.
+    bool active = true;                                  ///< Whether the object starts active.
+    float rotation = 0.f;                                ///< Initial rotation, in radians.
+    float mass = 1.f;                                    ///< Initial mass.
+    bool useGravity = false;                             ///< Initial gravity flag.
+    const DebugProbeTable* debugProbeTable = nullptr;    ///< Probe table found during construction, or nullptr.
+    std::vector<StagedDebugProbe> debugProbes;           ///< Probes staged after debugProbeTable, in order.
+};
+
+template <typename... Components>
+class ComponentView;
 
  /**
   * @class GameObjectManager
@@ -28,14 +126,255 @@
   */
 class GameObjectManager {
 private:
-    std::vector<GameObject*> gameObjects; ///< List of all active game objects.
+    template <typename... Components>
+    friend class ComponentView;
+
+    /**
+     * @brief Registry slot referenced by a handle's index.
+     */
+    struct Slot {
+        std::uint32_t denseIndex;  ///< Position of the object in the dense array, or InvalidIndex when free.
+        std::uint32_t generation;  ///< Incremented every time the slot is released.
+        std::uint32_t bucket;      ///< Update bucket holding the object, or InvalidIndex while unclassified.
+        std::uint32_t bucketIndex; ///< Position of the object in its bucket or in the unclassified list.
+        std::uint32_t pool;        ///< Pool the object was spawned from, or InvalidIndex if not pooled.
+    };
+
+    /**
+     * @brief Rarely read per-object data, kept out of GameObject so objects stay one cache line.
+     */
+    struct ColdData {
+        NameId name;                                  ///< Interned name of the object.
+        std::uint32_t nameIndex;                      ///< Position of the object in its name's entry of objectsByName.
+        const DebugProbeTable* debugProbes;           ///< Debug probes of the object's type, or nullptr if none.
+    };
+
+    /**
+     * @brief A command of one of the buffers being flushed, placed in the merged order.
+     */
+    struct FlushEntry {
+        CommandOrder order;        ///< Position in the merged order.
+        std::uint32_t buffer;      ///< Buffer holding the command.
+        std::uint32_t index;       ///< Index of the command in its buffer.
+
+        bool operator<(const FlushEntry& other) const {
+            if (order < other.order) {
+                return true;
+            }
+            if (other.order < order) {
+                return false;
+            }
+            return buffer < other.buffer;
+        }
+    };
+
+    /**
+     * @brief Group of objects of one concrete type, updated by a single loop.
+     */
+    struct UpdateBucket {
+        std::vector<GameObject*> objects; ///< Objects in the bucket, active objects first.
+        std::size_t activeCount = 0;      ///< Number of active objects at the front of the bucket.
+        void (*updateRange)(GameObject* const* objects, std::size_t count, float deltaTime); ///< Update loop for the bucket's type.
+        ComponentLayout components;       ///< Components held by the bucket's type; empty for the generic bucket.
+    };
+
+    /**
+     * @brief Index of the bucket for objects whose type was never registered.
+     */
+    static constexpr std::uint32_t GenericBucket = 0;
+
+    std::vector<Slot> slots;                ///< Slot table indexed by handle index.
+    std::vector<std::uint32_t> freeSlots;   ///< Indices of released slots, reused LIFO.
+    std::vector<GameObject*> gameObjects;   ///< Dense list of all registered game objects, active objects first.
+    std::size_t activeCount = 0;            ///< Number of active objects at the front of the dense list.
+    std::vector<std::uint32_t> denseToSlot; ///< Slot index owning each entry of the dense list.
+    TransformStore transforms;              ///< Hot per-object fields, in dense order.
+    bool parallelUpdates = true;            ///< Runs updateAll on the JobSystem when true.
+    bool updating = false;                  ///< True while updateAll is running object updates.
+
+    std::unique_ptr<KryptosEngine::SpatialIndex> spatialIndex; ///< Optional spatial index over object positions.
+    std::vector<std::uint8_t> spatialDirty;                    ///< Per-slot flag for moves made during updateAll.
+
+    std::vector<UpdateBucket> buckets;                           ///< Update buckets; bucket 0 uses virtual dispatch.
+    std::unordered_map<std::type_index, std::uint32_t> typeBuckets; ///< Bucket index of each registered type.
+    std::vector<GameObject*> unclassifiedObjects;                ///< Objects registered since the last classification.
+
+    std::vector<std::unique_ptr<ObjectPool>> pools;              ///< Block pools for spawned objects, one per type.
+    std::unordered_map<std::type_index, std::uint32_t> typePools; ///< Pool index of each spawned type.
+
+    std::vector<std::vector<GameObjectHandle>> objectsByName;    ///< Live objects with each name, indexed by NameId.
+    std::vector<ColdData> coldData;                              ///< Names and debug data, indexed by slot.
+
+    std::vector<std::unique_ptr<CommandBuffer>> commandBuffers;  ///< Deferred commands, one buffer per JobSystem thread.
+    std::vector<std::unique_ptr<CommandBuffer>> flushingBuffers; ///< Buffers being flushed, swapped with commandBuffers.
+    std::vector<FlushEntry> flushOrder;                          ///< Merged order of the commands being flushed.
+    mutable std::vector<NameId> prefixNameIds;                   ///< Scratch for findAllByPrefix.
+
+    std::vector<std::uint8_t> changeFlags;                       ///< Per-slot ChangeFlags bits for the current frame.
+    std::vector<std::uint32_t> changeVersions;                   ///< Per-slot frame number of the last change.
+    std::vector<std::vector<GameObjectHandle>> changedByThread;  ///< Objects first changed this frame, one list per JobSystem thread.
+    std::uint32_t changeFrame = 1;                               ///< Number of the current frame, starting at one.
+
+    GameObjectHandle lodFocus;                                   ///< Object update LOD distances are measured from, or null when off.
+    std::array<float, 3> lodBandsSquared{};                      ///< Squared distances beyond which objects tick every 2nd, 4th and 8th frame.
+    std::vector<float> lodElapsed;                               ///< Per-slot time accumulated since the object last ticked.
+    std::array<std::vector<GameObject*>, 4> lodTicking;          ///< Objects ticking this frame in the current bucket, by tick interval.
+    std::array<std::vector<float>, 4> lodDeltas;                 ///< Accumulated time of each entry of lodTicking.
+    std::uint32_t lodFrame = 0;                                  ///< Number of frames updated with update LOD on.
+    bool lodWasActive = false;                                   ///< True when the last updateAll used update LOD.
+    std::size_t lastTickedCount = 0;                             ///< Number of objects updated by the last updateAll.
+
+    std::thread::id mainThread;                                  ///< Thread that owns the registry and runs frames.
+    MpscQueue<PendingRegistration> pendingRegistrations;         ///< Registrations and destructions from other threads.
+    std::unordered_map<GameObject*, std::vector<StagedDebugProbe>> stagedDebugProbes; ///< Probes staged by objects constructed on the main thread.
+
+    /**
+     * @brief Gets the command buffer owned by the calling thread.
+     */
+    CommandBuffer& currentCommandBuffer();
+
+    /**
+     * @brief Adds an object to the registry and writes its initial state, on the main thread.
+     */
+    void addObject(GameObject* object, NameId name, const sf::Vector2f& position, bool active, float rotation, float mass, bool useGravity);
+
+    /**
+     * @brief Removes an object from the registry, on the main thread.
+     */
+    void removeObject(GameObject* object);
+
+    /**
+     * @brief Publishes the probe tables staged by an object constructed on the main thread.
+     */
+    void publishDebugProbes(GameObject* object);
+
+    /**
+     * @brief Withdraws an object's registration if the main thread has not published it yet.
+     * @return True if the object was never published and never will be.
+     */
+    bool cancelRegistration(GameObject* object);
+
+    /**
+     * @brief Deletes an object, or returns it to its pool if it was spawned, on the main thread.
+     */
+    void deleteObject(GameObject* object);
 
     /**
      * @brief Private constructor to enforce singleton pattern.
+     * Creates the generic bucket used for unregistered types.
+     */
+    GameObjectManager();
+
+    /**
+     * @brief Update loop for objects of a known concrete type.
+     *
+     * Calls `T::update` with a qualified name, so the call is bound statically and can be inlined.
+     * @tparam T The concrete type of every object in the range.
+     * @param objects The objects to update.
+     * @param count Number of objects in the range.
+     * @param deltaTime Time elapsed since the last frame.
+     */
+    template <typename T>
+    static void updateRangeOf(GameObject* const* objects, std::size_t count, float deltaTime) {
+        for (std::size_t i = 0; i < count; ++i) {
+            static_cast<T*>(objects[i])->T::update(deltaTime);
+        }
+    }
+
+    /**
+     * @brief Update loop for objects of unregistered types, using virtual dispatch.
+     * @param objects The objects to update.
+     * @param count Number of objects in the range.
+     * @param deltaTime Time elapsed since the last frame.
+     */
+    static void updateRangeVirtual(GameObject* const* objects, std::size_t count, float deltaTime);
+
+    /**
+     * @brief Creates a bucket for a concrete type and moves existing objects of that type into it.
+     * @param type The concrete type.
+     * @param updateRange The update loop for the type.
+     * @param describeComponents Builds the component layout of the type.
+     */
+    void addTypeBucket(std::type_index type, void (*updateRange)(GameObject* const*, std::size_t, float),
+        ComponentLayout (*describeComponents)());
+
+    /**
+     * @brief Finds the pool for a concrete type, creating it and the type's update bucket on first use.
+     * @param type The concrete type.
+     * @param size Size of the type, in bytes.
+     * @param alignment Alignment of the type, in bytes.
+     * @param updateRange The update loop for the type.
+     * @param describeComponents Builds the component layout of the type.
+     * @return Index of the pool.
+     */
+    std::uint32_t acquirePool(std::type_index type, std::size_t size, std::size_t alignment,
+        void (*updateRange)(GameObject* const*, std::size_t, float), ComponentLayout (*describeComponents)());
+
+    /**
+     * @brief Exchanges two entries of the dense list, their transform data and their slots' indices.
+     * @param first Dense index of the first entry.
+     * @param second Dense index of the second entry.
+     */
+    void swapDense(std::size_t first, std::size_t second);
+
+    /**
+     * @brief Exchanges two entries of a bucket or of the unclassified list and their slots' indices.
+     * @param objects The list holding both entries.
+     * @param first Index of the first entry.
+     * @param second Index of the second entry.
+     */
+    void swapInList(std::vector<GameObject*>& objects, std::size_t first, std::size_t second);
+
+    /**
+     * @brief Appends an object to a bucket and records its position in the slot.
+     * @param object The object to add.
+     * @param bucket Index of the bucket.
+     */
+    void addToBucket(GameObject* object, std::uint32_t bucket);
+
+    /**
+     * @brief Removes an object from its bucket or from the unclassified list.
+     * @param object The object to remove.
      */
-    GameObjectManager() = default;
+    void removeFromBucket(GameObject* object);
+
+    /**
+     * @brief Applies moves recorded during updateAll to the spatial index.
+     */
+    void syncSpatialIndex();
+
+    /**
+     * @brief Picks the active objects of a bucket that tick this frame, by distance from the focus.
+     *
+     * Fills lodTicking and lodDeltas, grouped by tick interval, and accumulates the frame's
+     * time for the objects that skip it.
+     * @param bucket The bucket.
+     * @param focus Position of the focus object.
+     * @param deltaTime Time elapsed since the last frame.
+     */
+    void selectTickingObjects(const UpdateBucket& bucket, const sf::Vector2f& focus, float deltaTime);
+
+    /**
+     * @brief Moves every unclassified object into the bucket of its concrete type.
+     *
+     * Classification is deferred until the first update, since an object's dynamic type
+     * is only final once its most-derived constructor has completed.
+     */
+    void classifyObjects();
 
 public:
+    /**
+     * @brief Contiguous, read-only range of game object pointers usable in range-based for loops.
+     */
+    struct ObjectRange {
+        GameObject* const* first; ///< First object in the range.
+        GameObject* const* last;  ///< One past the last object in the range.
+
+        GameObject* const* begin() const { return first; }
+        GameObject* const* end() const { return last; }
+        std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    };
+
     /**
      * @brief Deleted copy constructor to prevent copying the singleton instance.
      */
@@ -56,24 +395,676 @@ public:
     }
 
     /**
-     * @brief Registers a new game object.
+     * @brief Registers a new game object with its initial state. Safe from any thread.
      *
-     * Adds the object to the internal list if it is not already registered.
+     * On the main thread, interns the name, allocates a slot for the object and assigns its
+     * handle if it is not already registered. On any other thread the state is staged in a
+     * PendingRegistration without touching any shared table, and the object stays unregistered,
+     * with a null handle, until it is queued by submit and published at the next frame boundary.
      * @param object Pointer to the game object to register.
+     * @param name Name of the object.
+     * @param position Initial position.
+     * @param active Whether the object starts active.
+     * @param rotation Initial rotation, in radians.
+     * @param mass Initial mass.
+     * @param useGravity Initial gravity flag.
+     */
+    void registerObject(GameObject* object, std::string_view name, const sf::Vector2f& position, bool active, float rotation, float mass, bool useGravity);
+
+    /**
+     * @brief Records a debug probe registered by an object's constructor. Safe from any thread.
+     *
+     * Called by GameObject::registerDebugVariable. Once the constructing type has a probe
+     * table the object just adopts it, without locking or copying the name. Until then the
+     * probe is staged, and the tables are published once the object is fully constructed, by
+     * submit on the main thread or when the object is published otherwise.
+     * @param object The object under construction.
+     * @param objectType The type whose constructor is running.
+     * @param name Display name of the member.
+     * @param valueType Type of the member.
+     * @param offset Byte offset of the member from the object's GameObject base.
      */
-    void registerObject(GameObject* object);
+    void addDebugProbe(GameObject* object, std::type_index objectType, std::string_view name, DebugValueType valueType, std::ptrdiff_t offset);
 
     /**
      * @brief Unregisters an existing game object.
      *
-     * Removes the object from the internal list.
+     * Releases the object's slot and invalidates every handle issued for it. Called by the
+     * GameObject destructor. On the main thread any object may be unregistered. On other
+     * threads only objects that were never published may be, since the main thread may be
+     * using a published one; an object still waiting to be published is simply dropped.
+     * Off the main thread, destroy published objects with destroy rather than delete.
      * @param object Pointer to the game object to unregister.
+     * @throw std::logic_error if called off the main thread for a published object. Reached
+     * from a destructor, this terminates the program rather than free an object in use.
      */
     void unregisterObject(GameObject* object);
 
+    /**
+     * @brief Completes the registration of a fully constructed object. Call once per object.
+     *
+     * An object staged off the main thread is queued, so it is published, and receives
+     * GameObject::onRegistered, at the next frame boundary. An object registered on the main
+     * thread has its staged debug probes published and receives onRegistered at once. create
+     * and spawn call this themselves; objects constructed with new must be passed to it.
+     * @param object A fully constructed game object.
+     */
+    void submit(GameObject* object);
+
+    /**
+     * @brief Constructs a game object on the heap. Safe from any thread.
+     *
+     * On the main thread this is the same as `new T`. On any other thread, such as a level
+     * streaming thread, the object is queued once its constructor has finished and becomes
+     * visible at the next frame boundary; until then it has a null handle and only its own
+     * members may be used. Constructors run this way must not touch shared engine state
+     * beyond the GameObject base and debug probe registration; setup needing the handle or
+     * shared systems goes in GameObject::onRegistered, which runs on the main thread.
+     * @tparam T A type derived from GameObject.
+     * @param args Arguments forwarded to T's constructor.
+     * @return The new object. Destroy it with destroy.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_base_of_v<GameObject, T>, "create requires a GameObject-derived type");
+        T* object = new T(std::forward<Args>(args)...);
+        submit(object);
+        return object;
+    }
+
+    /**
+     * @brief Destroys a game object. Safe from any thread, and never blocks.
+     *
+     * On the main thread outside updateAll the object is deleted at once. During updateAll,
+     * and on JobSystem workers, a published object is recorded in the calling thread's command
+     * buffer and deleted when commands are flushed after the updates. On any other thread, such
+     * as a level streaming thread, a published object is queued and deleted by the main thread
+     * at its next publishRegistrations. An object that was never published is deleted at once
+     * on any thread. Spawned objects are returned to their pool instead of deleted. Request the
+     * destruction of an object only once.
+     * @param object An object created with create, spawn or new, or nullptr.
+     */
+    void destroy(GameObject* object);
+
+    /**
+     * @brief Publishes objects constructed and applies destructions requested on other threads.
+     *
+     * Called automatically at the start of updateAll, which is the frame boundary. Must be
+     * called from the main thread, outside updateAll. Call it once more at shutdown, after
+     * joining the threads that create or destroy objects, so their last requests are applied.
+     */
+    void publishRegistrations();
+
+    /**
+     * @brief Checks whether the calling thread is the main thread.
+     *
+     * The main thread is the thread that first used the GameObjectManager.
+     * @return True on the main thread.
+     */
+    bool isMainThread() const {
+        return std::this_thread::get_id() == mainThread;
+    }
+
+    /**
+     * @brief Gives a concrete game object type its own update bucket.
+     *
+     * Objects whose dynamic type is exactly T are stored contiguously and updated by a loop
+     * that calls `T::update` directly, without a virtual call. Objects of types derived from T
+     * still use virtual dispatch unless they are registered as well. The bucket only orders
+     * pointers: objects allocated with new stay scattered across the heap, and with tens of
+     * thousands of them the loop is bound by cache misses rather than by dispatch. Create
+     * such objects with spawn, so the bucket also walks its type's pool in address order.
+     * The type's Components tuple, if any, is read here, so view can find its objects.
+     * Registering the same type twice has no effect.
+     * @tparam T A type derived from GameObject.
+     */
+    template <typename T>
+    void registerType() {
+        static_assert(std::is_base_of_v<GameObject, T>, "registerType requires a GameObject-derived type");
+        addTypeBucket(std::type_index(typeid(T)), &updateRangeOf<T>, &componentLayoutOf<T>);
+    }
+
+    /**
+     * @brief Creates a game object in the pool for its type.
+     *
+     * Objects of one type are packed into shared chunks, and blocks freed by despawn are
+     * reused, so steady spawning causes no heap allocation. The type is also given its own
+     * update bucket, as if registerType had been called. Main thread only, outside updateAll:
+     * the pools are not synchronised, and the object must be registered as it is constructed.
+     * Other threads use create, and updates use spawnDeferred.
+     * @tparam T A type derived from GameObject.
+     * @param args Arguments forwarded to T's constructor.
+     * @return The new object. Destroy it with despawn, never with delete.
+     * @throw std::logic_error if called off the main thread.
+     */
+    template <typename T, typename... Args>
+    T* spawn(Args&&... args) {
+        static_assert(std::is_base_of_v<GameObject, T>, "spawn requires a GameObject-derived type");
+        if (!isMainThread()) {
+            throw std::logic_error("spawn must be called on the main thread; use create or spawnDeferred");
+        }
+        const std::uint32_t poolIndex = acquirePool(std::type_index(typeid(T)), sizeof(T), alignof(T), &updateRangeOf<T>, &componentLayoutOf<T>);
+        ObjectPool& pool = *pools[poolIndex];
+
+        void* block = pool.acquire();
+        T* object;
+        try {
+            object = ::new (block) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            pool.release(block);
+            throw;
+        }
+
+        slots[object->handle.index].pool = poolIndex;
+        submit(object);
+        return object;
+    }
+
+    /**
+     * @brief Destroys a game object created with spawn and returns its memory to its pool.
+     *
+     * Main thread only, outside updateAll; updates use despawnDeferred.
+     * @param object The object to destroy.
+     * @throw std::logic_error if called off the main thread, or if the object was not created with spawn.
+     */
+    void despawn(GameObject* object);
+
+    /**
+     * @brief Requests a spawn that is applied at the next sync point.
+     *
+     * Safe to call from any object's update, on any JobSystem thread, without locking. The
+     * arguments are copied or moved into the command and forwarded to spawn<T> when the
+     * commands are flushed, at the end of updateAll or by flushCommands.
+     * @tparam T A type derived from GameObject.
+     * @param args Arguments for T's constructor.
+     */
+    template <typename T, typename... Args>
+    void spawnDeferred(Args&&... args) {
+        static_assert(std::is_base_of_v<GameObject, T>, "spawnDeferred requires a GameObject-derived type");
+        currentCommandBuffer().recordSpawn(
+            [arguments = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+                std::apply([](auto&&... unpacked) {
+                    GameObjectManager::getInstance().spawn<T>(std::move(unpacked)...);
+                    }, std::move(arguments));
+            });
+    }
+
+    /**
+     * @brief Requests that a spawned object be despawned at the next sync point.
+     *
+     * Safe to call from any object's update, on any JobSystem thread, without locking.
+     * Requesting the same object more than once is harmless.
+     * @param object An object created with spawn or spawnDeferred.
+     * @throw std::logic_error if the object was not created with spawn.
+     */
+    void despawnDeferred(GameObject* object);
+
+    /**
+     * @brief Applies every deferred despawn, then every deferred spawn.
+     *
+     * Commands from all threads are applied in one deterministic order: those recorded
+     * outside updateAll first, then those recorded by each update in update order, each in
+     * recording order. Which thread ran an update does not matter. Commands recorded while
+     * applying, by constructors or onRegistered, are applied by the same call, in further
+     * passes until none are left.
+     * Called automatically at the end of updateAll. Call it directly to apply commands
+     * recorded outside updateAll. Must be called from the main thread, outside updateAll.
+     */
+    void flushCommands();
+
+    /**
+     * @brief Finds a live object by name.
+     *
+     * The name is looked up once in the NameTable; the rest is integer indexing.
+     * @param name The name to search for.
+     * @return The handle of an object with that name, or a null handle if there is none.
+     * If several objects share the name, any one of them is returned.
+     */
+    GameObjectHandle findByName(std::string_view name) const;
+
+    /**
+     * @brief Finds a live object by interned name, without any hashing.
+     * @param nameId The interned name to search for.
+     * @return The handle of an object with that name, or a null handle if there is none.
+     */
+    GameObjectHandle findByName(NameId nameId) const;
+
+    /**
+     * @brief Finds every live object whose name starts with a prefix.
+     *
+     * Uses a scratch buffer owned by the manager, so repeated searches do not allocate.
+     * @param prefix The prefix to match.
+     * @param results Receives the handles of the matching objects, grouped by name in name order.
+     */
+    void findAllByPrefix(std::string_view prefix, std::vector<GameObjectHandle>& results) const;
+
+    /**
+     * @brief Finds every live object whose name starts with a prefix, using a caller's scratch buffer.
+     * @param prefix The prefix to match.
+     * @param results Receives the handles of the matching objects, grouped by name in name order.
+     * @param scratch Reusable buffer for the matching name IDs; its contents are replaced.
+     */
+    void findAllByPrefix(std::string_view prefix, std::vector<GameObjectHandle>& results, std::vector<NameId>& scratch) const;
+
+    /**
+     * @brief Provides access to the object pools, for statistics.
+     * @return The pools, one per spawned type.
+     */
+    const std::vector<std::unique_ptr<ObjectPool>>& getPools() const {
+        return pools;
+    }
+
+    /**
+     * @brief Updates every registered game object.
+     *
+     * Only active objects are updated. The active part of each update bucket is split into
+     * chunks that run on the JobSystem, so updates of different objects execute concurrently.
+     * While updateAll runs, an object's update:
+     *   - may read and write its own state: its members, its own TransformStore entry
+     *     (through its getters and setters) and components it owns;
+     *   - must not write, and should not read, the state of any other game object;
+     *   - must not construct, destroy, register, unregister, activate or deactivate game objects
+     *     directly, but may request spawns and despawns with spawnDeferred and despawnDeferred.
+     * Deferred commands are applied once every update has finished.
+     * With parallel updates disabled, objects are updated on the calling thread, bucket by bucket,
+     * in a deterministic order. With update LOD set, distant objects may skip the frame; see
+     * setUpdateLod.
+     * @param deltaTime Time elapsed since the last frame.
+     */
+    void updateAll(float deltaTime);
+
+    /**
+     * @brief Ticks objects far from a focus object less often.
+     *
+     * Each frame, active objects farther from the focus than the given distances are updated
+     * only every 2nd, 4th or 8th frame, receiving the time accumulated since their last
+     * update. Objects of one interval are phased by slot, so each frame updates an even share
+     * of them. Distances must be increasing; use a very large value to leave a band unused.
+     * While the focus object is destroyed, every object is updated every frame.
+     * @param focus The object distances are measured from, such as the player.
+     * @param halfRateDistance Distance beyond which objects tick every 2nd frame.
+     * @param quarterRateDistance Distance beyond which objects tick every 4th frame.
+     * @param eighthRateDistance Distance beyond which objects tick every 8th frame.
+     */
+    void setUpdateLod(GameObjectHandle focus, float halfRateDistance, float quarterRateDistance, float eighthRateDistance);
+
+    /**
+     * @brief Updates every active object every frame again.
+     */
+    void disableUpdateLod();
+
+    /**
+     * @brief Gets the number of objects the last updateAll updated.
+     * @return The number of updated objects; below the active count while update LOD skips some.
+     */
+    std::size_t getLastTickedCount() const {
+        return lastTickedCount;
+    }
+
+    /**
+     * @brief Enables or disables parallel updates.
+     *
+     * Disabling gives a deterministic single-threaded update order for debugging.
+     * @param enabled True to run updates on the JobSystem, false to run them on the calling thread.
+     */
+    void setParallelUpdates(bool enabled);
+
+    /**
+     * @brief Checks whether updates run in parallel.
+     * @return True if updateAll uses the JobSystem.
+     */
+    bool getParallelUpdates() const;
+
+    /**
+     * @brief Checks whether a handle still refers to a live game object.
+     * @param handle The handle to check.
+     * @return True if the handle's slot is occupied by the generation it was issued for.
+     */
+    bool isValid(GameObjectHandle handle) const;
+
+    /**
+     * @brief Resolves a handle to its game object.
+     * @param handle The handle to resolve.
+     * @return Pointer to the game object, or nullptr if the handle is null or stale.
+     */
+    GameObject* resolve(GameObjectHandle handle) const;
+
+    /**
+     * @brief Activates or deactivates a game object.
+     *
+     * Moves the object across the boundary between the active and inactive partitions
+     * of the dense list and of its bucket, in O(1).
+     * @param object The object to change.
+     * @param state True to activate the object, false to deactivate it.
+     */
+    void setObjectActive(GameObject* object, bool state);
+
+    /**
+     * @brief Checks whether a live handle's object is in the active partition.
+     * @param handle A live handle.
+     * @return True if the object is active.
+     */
+    bool isObjectActive(GameObjectHandle handle) const {
+        return slots[handle.index].denseIndex < activeCount;
+    }
+
+    /**
+     * @brief Gets the number of active objects.
+     *
+     * Active objects occupy dense indices [0, getActiveCount()) in getGameObjects()
+     * and in every TransformStore column.
+     * @return The number of active objects.
+     */
+    std::size_t getActiveCount() const {
+        return activeCount;
+    }
+
+    /**
+     * @brief Provides the active partition of the dense list.
+     * @return A range over every active game object.
+     */
+    ObjectRange getActiveObjects() const {
+        return { gameObjects.data(), gameObjects.data() + activeCount };
+    }
+
+    /**
+     * @brief Provides the inactive partition of the dense list.
+     * @return A range over every inactive game object.
+     */
+    ObjectRange getInactiveObjects() const {
+        return { gameObjects.data() + activeCount, gameObjects.data() + gameObjects.size() };
+    }
+
+    /**
+     * @brief Moves a game object and keeps the spatial index in sync.
+     *
+     * Outside updateAll the spatial index is updated immediately. During updateAll the move is
+     * recorded and applied once every update has finished, since the index is not thread-safe.
+     * @param handle A live handle.
+     * @param position The object's new position.
+     */
+    void setObjectPosition(GameObjectHandle handle, const sf::Vector2f& position);
+
+    /**
+     * @brief Records that parts of an object changed during the current frame.
+     *
+     * The GameObject setters call this; systems that write the TransformStore columns directly
+     * should call it for the objects they change. Safe to call during updateAll for the object
+     * being updated, on any JobSystem thread, without locking.
+     * @param handle A live handle.
+     * @param flags A combination of ChangeFlags bits.
+     */
+    void markChanged(GameObjectHandle handle, std::uint8_t flags);
+
+    /**
+     * @brief Gets the parts of an object that changed during the current frame.
+     * @param handle A live handle.
+     * @return A combination of ChangeFlags bits, or zero if nothing changed.
+     */
+    std::uint8_t getChangeFlags(GameObjectHandle handle) const {
+        return changeFlags[handle.index];
+    }
+
+    /**
+     * @brief Gets the frame in which an object last changed.
+     *
+     * Unlike the change flags, versions survive clearChanges, so a consumer that skips frames
+     * can cache the version it last saw and compare it with this one.
+     * @param handle A live handle.
+     * @return The frame number of the object's last change.
+     */
+    std::uint32_t getChangeVersion(GameObjectHandle handle) const {
+        return changeVersions[handle.index];
+    }
+
+    /**
+     * @brief Gets the interned name of an object.
+     * @param handle A live handle.
+     * @return The object's name ID.
+     */
+    NameId getObjectNameId(GameObjectHandle handle) const {
+        return coldData[handle.index].name;
+    }
+
+    /**
+     * @brief Gets the debug probe table of an object.
+     * @param handle A live handle.
+     * @return The table shared by the object's type, or nullptr if it has no probes.
+     */
+    const DebugProbeTable* getObjectDebugProbes(GameObjectHandle handle) const {
+        return coldData[handle.index].debugProbes;
+    }
+
+    /**
+     * @brief Sets the debug probe table of an object.
+     * @param handle A live handle.
+     * @param probes A table owned by the DebugProbeRegistry.
+     */
+    void setObjectDebugProbes(GameObjectHandle handle, const DebugProbeTable* probes) {
+        coldData[handle.index].debugProbes = probes;
+    }
+
+    /**
+     * @brief Gets the number of the current frame, as used by getChangeVersion.
+     * @return The current frame number.
+     */
+    std::uint32_t getChangeFrame() const {
+        return changeFrame;
+    }
+
+    /**
+     * @brief Lists every live object changed during the current frame.
+     *
+     * Gathers the per-thread change lists into one, dropping destroyed objects. Each object
+     * appears once; read getChangeFlags for what changed. Must be called from the main thread,
+     * outside updateAll.
+     * @return The handles of the changed objects, valid until the next change or clearChanges.
+     */
+    const std::vector<GameObjectHandle>& getChangedObjects();
+
+    /**
+     * @brief Ends the current frame's change tracking.
+     *
+     * Clears every object's change flags and the changed list, and advances the frame number.
+     * Call once per frame after every consumer has run. Must be called from the main thread,
+     * outside updateAll.
+     */
+    void clearChanges();
+
+    /**
+     * @brief Installs the spatial index used to answer proximity queries.
+     *
+     * Every registered object is inserted into the new index. Passing nullptr disables
+     * spatial indexing.
+     * @param index The index to use, e.g. a UniformGridIndex or a LooseQuadtreeIndex.
+     */
+    void setSpatialIndex(std::unique_ptr<KryptosEngine::SpatialIndex> index);
+
+    /**
+     * @brief Provides access to the installed spatial index.
+     *
+     * Queries return handles; resolve them with resolve() or getDenseIndex().
+     * @return Pointer to the spatial index, or nullptr if none is installed.
+     */
+    KryptosEngine::SpatialIndex* getSpatialIndex() const {
+        return spatialIndex.get();
+    }
+
+    /**
+     * @brief Gets the dense index of a live handle.
+     *
+     * The handle must be valid; use isValid first when that is not guaranteed.
+     * @param handle A live handle.
+     * @return Index of the object in getGameObjects() and in every TransformStore column.
+     */
+    std::uint32_t getDenseIndex(GameObjectHandle handle) const {
+        return slots[handle.index].denseIndex;
+    }
+
+    /**
+     * @brief Provides access to the structure-of-arrays transform storage.
+     * @return A reference to the transform store, indexed by dense index.
+     */
+    TransformStore& getTransforms() {
+        return transforms;
+    }
+
+    /**
+     * @brief Provides read-only access to the structure-of-arrays transform storage.
+     * @return A constant reference to the transform store, indexed by dense index.
+     */
+    const TransformStore& getTransforms() const {
+        return transforms;
+    }
+
     /**
      * @brief Provides access to all registered game objects.
+     *
+     * The vector is a dense view over the registry, with active objects first; its order changes
+     * when objects are unregistered, activated or deactivated.
      * @return A constant reference to the vector of game object pointers.
      */
     const std::vector<GameObject*>& getGameObjects() const;
+
+    /**
+     * @brief Queries the active objects holding every one of a set of components.
+     *
+     * Only objects of registered or spawned types are found, since component layouts are
+     * read when a type gets its update bucket. Objects whose type lacks a component are
+     * skipped bucket by bucket, without looking at them.
+     * @tparam Components The component types to require.
+     * @return A view over the matching objects; see ComponentView.
+     */
+    template <typename... Components>
+    ComponentView<Components...> view();
 };
+
+ /**
+  * @class ComponentView
+  * @brief Iterates the active objects whose type holds every one of a set of components.
+  *
+  * Each update bucket holds objects of one concrete type, so it either matches the query as a
+  * whole or not at all. For a matching bucket the byte offset of each component within the
+  * type is found once, from its first object, and every object's components are then reached
+  * by pointer arithmetic, without RTTI or per-object type checks.
+  *
+  * A view reads the buckets when it is iterated, so it stays valid across frames, but objects
+  * must not be registered, unregistered, activated or deactivated while it is being iterated.
+  * @tparam Components The required component types.
+  */
+template <typename... Components>
+class ComponentView {
+private:
+    /**
+     * @brief Number of objects below which eachParallel iterates on the calling thread.
+     */
+    static constexpr std::size_t MinChunkSize = 64;
+
+    using Offsets = std::array<std::ptrdiff_t, sizeof...(Components)>;
+
+    GameObjectManager& manager; ///< Manager whose buckets are iterated.
+    ComponentMask mask;         ///< Mask of the required component types.
+
+    /**
+     * @brief Checks whether a bucket's type holds every required component and has active objects.
+     */
+    bool matches(const GameObjectManager::UpdateBucket& bucket) const {
+        return bucket.activeCount > 0 && (bucket.components.mask & mask) == mask;
+    }
+
+    /**
+     * @brief Finds the byte offset of each required component within a matching bucket's type.
+     */
+    static Offsets offsetsOf(const GameObjectManager::UpdateBucket& bucket) {
+        GameObject* first = bucket.objects.front();
+        const char* base = reinterpret_cast<const char*>(first);
+        return { { (static_cast<const char*>(bucket.components.find(componentTypeId<Components>())(first)) - base)... } };
+    }
+
+    /**
+     * @brief Calls a function for a range of a bucket's objects and their components.
+     */
+    template <typename Function, std::size_t... I>
+    static void eachInRange(GameObject* const* objects, std::size_t begin, std::size_t end, const Offsets& offsets,
+        Function& function, std::index_sequence<I...>) {
+        for (std::size_t i = begin; i < end; ++i) {
+            char* base = reinterpret_cast<char*>(objects[i]);
+            function(*objects[i], *reinterpret_cast<Components*>(base + offsets[I])...);
+        }
+    }
+
+public:
+    /**
+     * @brief Creates a view over a manager's objects.
+     * @param manager The manager to query.
+     */
+    explicit ComponentView(GameObjectManager& manager)
+        : manager(manager),
+        mask(componentMaskOf<Components...>()) {
+    }
+
+    /**
+     * @brief Calls a function for every matching object, bucket by bucket.
+     * @param function Called as `function(GameObject& object, Components&... components)`.
+     */
+    template <typename Function>
+    void each(Function&& function) const {
+        for (const GameObjectManager::UpdateBucket& bucket : manager.buckets) {
+            if (matches(bucket)) {
+                eachInRange(bucket.objects.data(), 0, bucket.activeCount, offsetsOf(bucket), function,
+                    std::index_sequence_for<Components...>());
+            }
+        }
+    }
+
+    /**
+     * @brief Calls a function for every matching object, spread over the JobSystem.
+     *
+     * Each matching bucket is split into chunks as in GameObjectManager::updateAll, and the
+     * call returns once every chunk has run. The function runs concurrently for different
+     * objects, so it must only touch the object and components it is given.
+     * @param function Called as `function(GameObject& object, Components&... components)`.
+     */
+    template <typename Function>
+    void eachParallel(Function&& function) const {
+        KryptosEngine::JobSystem& jobSystem = KryptosEngine::JobSystem::getInstance();
+        for (const GameObjectManager::UpdateBucket& bucket : manager.buckets) {
+            if (!matches(bucket)) {
+                continue;
+            }
+
+            GameObject* const* objects = bucket.objects.data();
+            const Offsets offsets = offsetsOf(bucket);
+            const std::size_t count = bucket.activeCount;
+            const std::size_t chunkSize = std::max(MinChunkSize, count / (jobSystem.getThreadCount() * 4));
+            jobSystem.parallelFor(count, chunkSize, [objects, &offsets, &function](std::size_t begin, std::size_t end) {
+                eachInRange(objects, begin, end, offsets, function, std::index_sequence_for<Components...>());
+                });
+        }
+    }
+
+    /**
+     * @brief Counts the matching objects.
+     * @return The number of active objects the view iterates.
+     */
+    std::size_t size() const {
+        std::size_t count = 0;
+        for (const GameObjectManager::UpdateBucket& bucket : manager.buckets) {
+            if (matches(bucket)) {
+                count += bucket.activeCount;
+            }
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Queries the active objects holding every one of a set of components.
+ * @tparam Components The component types to require.
+ * @return A view over the matching objects.
+ */
+template <typename... Components>
+ComponentView<Components...> GameObjectManager::view() {
+    return ComponentView<Components...>(*this);
+}
@@ -0,0 +1,73 @@
+/*
+ * MpscQueue.h - Kryptos Lock-Free Multi-Producer Queue
+ * ----------------------------------------------------
+ * Defines MpscQueue, an intrusive queue that any number of threads can push
+ * to without locking and that a single consumer drains in one step.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - atomic: For the lock-free list head.
+ */
+
+#pragma once
+#include <atomic>
+
+ /**
+  * @class MpscQueue
+  * @brief Intrusive lock-free multi-producer, single-consumer queue.
+  *
+  * Producers push nodes onto an atomic list head with a compare-and-swap loop. The consumer
+  * takes the whole list with one exchange and reverses it, so nodes come out in push order.
+  * Because the consumer never pops single nodes, the queue is free of ABA problems. The
+  * queue does not own its nodes; they must outlive their time in the queue.
+  * @tparam Node A type with a `Node* next` member, which the queue overwrites.
+  */
+template <typename Node>
+class MpscQueue {
+private:
+    std::atomic<Node*> head{ nullptr }; ///< Most recently pushed node; the list runs newest first.
+
+public:
+    MpscQueue() = default;
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * @brief Pushes a node. Safe from any thread.
+     *
+     * Everything the producer wrote before pushing is visible to the consumer that takes the node.
+     * @param node The node to push.
+     */
+    void push(Node* node) {
+        Node* expected = head.load(std::memory_order_relaxed);
+        do {
+            node->next = expected;
+        } while (!head.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Takes every queued node. Must only be called by the consumer.
+     * @return The first node pushed, linked through `next` in push order, or nullptr if empty.
+     */
+    Node* takeAll() {
+        Node* node = head.exchange(nullptr, std::memory_order_acquire);
+        Node* ordered = nullptr;
+        while (node != nullptr) {
+            Node* next = node->next;
+            node->next = ordered;
+            ordered = node;
+            node = next;
+        }
+        return ordered;
+    }
+
+    /**
+     * @brief Checks whether the queue holds any nodes.
+     * @return True if nothing is queued. May be stale as soon as it returns.
+     */
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == nullptr;
+    }
+};
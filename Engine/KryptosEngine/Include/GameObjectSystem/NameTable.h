@@ -0,0 +1,131 @@
+/*
+ * NameTable.h - Kryptos Interned Names
+ * ------------------------------------
+ * Defines the NameTable singleton, which stores each distinct game object
+ * name once and identifies it by a compact integer NameId. Comparing names
+ * becomes an integer comparison, and reading one returns a view into the
+ * table instead of a copy.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - deque: Stable storage for the interned strings.
+ *   - array, atomic, memory: Chunked views that can be read without locking.
+ *   - unordered_map, string_view: For looking names up by content.
+ *   - mutex: Guards interning against concurrent callers.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+ /**
+  * @brief Compact identifier of an interned name. Equal names always have equal IDs.
+  */
+using NameId = std::uint32_t;
+
+/**
+ * @class NameTable
+ * @brief Singleton string-interning table for object names.
+ *
+ * IDs are assigned densely from zero in interning order, so they can index arrays
+ * directly. Names are never removed, so views and IDs stay valid for the program's lifetime.
+ * The views are stored in fixed-size chunks that never move, so view can read them without
+ * locking while other threads intern new names.
+ */
+class NameTable {
+private:
+    static constexpr std::size_t ChunkShift = 10;                  ///< log2 of the number of views per chunk.
+    static constexpr std::size_t ChunkSize = std::size_t(1) << ChunkShift; ///< Number of views per chunk.
+    static constexpr std::size_t MaxChunks = 4096;                 ///< Number of chunk pointers; caps the table at 4M names.
+
+    std::deque<std::string> names;                          ///< Interned strings; deque elements never move.
+    std::array<std::atomic<const std::string_view*>, MaxChunks> viewChunks{}; ///< View of each interned string, by ID, in chunks.
+    std::vector<std::unique_ptr<std::string_view[]>> chunkStorage; ///< Owns the chunks.
+    std::size_t count = 0;                                  ///< Number of interned names.
+    std::unordered_map<std::string_view, NameId> lookup;    ///< ID of each interned string.
+    std::vector<NameId> sortedIds;                          ///< IDs ordered by name up to sortedCount, then newer IDs.
+    std::size_t sortedCount = 0;                            ///< Number of leading sortedIds in name order.
+    std::vector<NameId> mergeBuffer;                        ///< Reused when merging new IDs into sortedIds.
+    mutable std::mutex mutex;                               ///< Guards interning and lookups.
+
+    /**
+     * @brief Private constructor to enforce singleton pattern.
+     */
+    NameTable() = default;
+
+public:
+    /**
+     * @brief Returned by find when a name has never been interned.
+     */
+    static constexpr NameId InvalidName = 0xFFFFFFFFu;
+
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+
+    /**
+     * @brief Provides access to the singleton instance of NameTable.
+     * @return A reference to the singleton instance.
+     */
+    static NameTable& getInstance() {
+        static NameTable instance;
+        return instance;
+    }
+
+    /**
+     * @brief Gets the ID of a name, adding it to the table if needed.
+     * @param name The name to intern.
+     * @return The name's ID.
+     * @throw std::length_error if the table is full.
+     */
+    NameId intern(std::string_view name);
+
+    /**
+     * @brief Gets the ID of a name without adding it.
+     * @param name The name to look up.
+     * @return The name's ID, or InvalidName if it was never interned.
+     */
+    NameId find(std::string_view name) const;
+
+    /**
+     * @brief Collects the IDs of every interned name starting with a prefix.
+     *
+     * Names interned since the last search are sorted among themselves and merged into the
+     * index, so a search costs a sort of the new names only. Allocates nothing once the
+     * index and the results have grown to size.
+     * @param prefix The prefix to match. An empty prefix matches every name.
+     * @param results Receives the matching IDs, in name order, after any existing contents.
+     */
+    void findWithPrefix(std::string_view prefix, std::vector<NameId>& results);
+
+    /**
+     * @brief Gets the text of an interned name.
+     *
+     * Does not lock and is safe while other threads intern names. The ID must have reached
+     * the calling thread with the usual happens-before ordering, as it does through
+     * GameObjectManager registration.
+     * @param id A valid name ID.
+     * @return A view of the name, valid for the program's lifetime.
+     */
+    std::string_view view(NameId id) const {
+        return viewChunks[id >> ChunkShift].load(std::memory_order_acquire)[id & (ChunkSize - 1)];
+    }
+
+    /**
+     * @brief Gets the number of interned names.
+     * @return One past the largest ID issued.
+     */
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return count;
+    }
+};
@@ -0,0 +1,102 @@
+/*
+ * ObjectPool.h - Kryptos Fixed-Size Block Pool
+ * --------------------------------------------
+ * Defines the ObjectPool class, a fixed-size block allocator used by the
+ * GameObjectManager to spawn game objects of one concrete type without
+ * going through the general-purpose heap for every object.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - vector: For the list of allocated chunks.
+ *   - string: For the pooled type's display name.
+ */
+
+#pragma once
+#include <vector>
+#include <string>
+#include <cstddef>
+
+ /**
+  * @class ObjectPool
+  * @brief Allocator handing out equally sized, suitably aligned blocks.
+  *
+  * Blocks are carved from chunks allocated on demand, and released blocks are kept on an
+  * intrusive free list and handed out again first, so a steady spawn/despawn cycle causes
+  * no heap traffic. Chunks are only freed when the pool is destroyed. The pool only manages
+  * memory; constructing and destroying objects in the blocks is up to the caller.
+  */
+class ObjectPool {
+private:
+    /**
+     * @brief Header written into a free block, linking it to the next free block.
+     */
+    struct FreeBlock {
+        FreeBlock* next; ///< Next free block, or nullptr.
+    };
+
+    std::string typeName;          ///< Display name of the pooled type.
+    std::size_t blockSize;         ///< Size of each block, a multiple of the alignment.
+    std::size_t blockAlignment;    ///< Alignment of each block.
+    std::size_t blocksPerChunk;    ///< Number of blocks carved from each chunk.
+    std::vector<void*> chunks;     ///< Chunks allocated so far.
+    FreeBlock* freeList;           ///< Head of the free block list.
+    std::size_t liveCount;         ///< Number of blocks currently handed out.
+    std::size_t highWaterMark;     ///< Largest number of blocks handed out at once.
+
+    /**
+     * @brief Allocates a new chunk and pushes its blocks onto the free list.
+     */
+    void grow();
+
+public:
+    /**
+     * @brief Constructs an empty pool. No memory is allocated until the first block is requested.
+     * @param typeName Display name of the pooled type, shown in the debug window.
+     * @param size Size of the pooled type, in bytes.
+     * @param alignment Alignment of the pooled type, in bytes.
+     * @param blocksPerChunk Number of blocks allocated at a time.
+     */
+    ObjectPool(const std::string& typeName, std::size_t size, std::size_t alignment, std::size_t blocksPerChunk = 64);
+
+    /**
+     * @brief Frees every chunk. Objects still living in the pool are not destroyed.
+     */
+    ~ObjectPool();
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @brief Takes a block from the pool, growing it if no free block is left.
+     * @return Pointer to uninitialised memory for one object.
+     */
+    void* acquire();
+
+    /**
+     * @brief Returns a block to the pool. The object in it must already be destroyed.
+     * @param block A block previously returned by acquire().
+     */
+    void release(void* block);
+
+    const std::string& getTypeName() const {
+        return typeName;
+    }
+
+    std::size_t getLiveCount() const {
+        return liveCount;
+    }
+
+    std::size_t getHighWaterMark() const {
+        return highWaterMark;
+    }
+
+    /**
+     * @brief Gets the number of blocks allocated so far, in use or free.
+     * @return The pool's capacity.
+     */
+    std::size_t getCapacity() const {
+        return chunks.size() * blocksPerChunk;
+    }
+};
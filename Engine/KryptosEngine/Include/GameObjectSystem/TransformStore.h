@@ -0,0 +1,76 @@
+/*
+ * TransformStore.h - Kryptos Game Object Component Storage
+ * --------------------------------------------------------
+ * Stores the per-frame hot fields of every registered game object
+ * (position, rotation, velocity, force, mass and gravity flag) as parallel
+ * contiguous arrays, so bulk passes stream over packed values instead
+ * of pulling whole GameObject instances through the cache.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SFML/Graphics.hpp: For vector and angle types.
+ *   - vector: For the component columns.
+ *   - cstdint: For packed flag columns.
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+ /**
+  * @struct TransformStore
+  * @brief Structure-of-arrays storage for game object transforms and physics properties.
+  *
+  * Every column is indexed by the object's dense slot in the GameObjectManager, so entry
+  * `i` of each column belongs to `GameObjectManager::getGameObjects()[i]`. The columns are
+  * exposed directly for bulk passes; structural changes must go through the manager.
+  * Active objects occupy the front of every column, see GameObjectManager::getActiveCount.
+  */
+struct TransformStore {
+    std::vector<float> positionX;          ///< World-space X position of each object.
+    std::vector<float> positionY;          ///< World-space Y position of each object.
+    std::vector<float> rotation;           ///< Rotation of each object, in radians.
+    std::vector<float> velocityX;          ///< X velocity of each object, in units per second.
+    std::vector<float> velocityY;          ///< Y velocity of each object, in units per second.
+    std::vector<float> forceX;             ///< X force accumulated since the last physics update.
+    std::vector<float> forceY;             ///< Y force accumulated since the last physics update.
+    std::vector<float> mass;               ///< Mass of each object, used for physics calculations.
+    std::vector<std::uint8_t> useGravity;  ///< Non-zero if the object is affected by gravity.
+
+    /**
+     * @brief Gets the number of entries in the store.
+     * @return The number of objects with transform data.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Reserves capacity in every column.
+     * @param capacity The number of entries to reserve.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Appends an entry to every column.
+     * @param position Initial position of the object.
+     * @param angle Initial rotation of the object.
+     * @param objectMass Mass of the object.
+     * @param gravity Whether the object is affected by gravity.
+     */
+    void pushBack(const sf::Vector2f& position, const sf::Angle& angle, float objectMass, bool gravity);
+
+    /**
+     * @brief Exchanges two entries in every column.
+     * @param first Index of the first entry.
+     * @param second Index of the second entry.
+     */
+    void swapEntries(std::size_t first, std::size_t second);
+
+    /**
+     * @brief Removes the last entry from every column.
+     */
+    void popBack();
+};
@@ -0,0 +1,185 @@
+/*
+ * JobSystem.h - Kryptos Work-Stealing Job System
+ * ----------------------------------------------
+ * Provides a thread pool sized to the machine, with one work queue per
+ * thread. Idle threads steal work from the other queues, so uneven chunks
+ * still keep every core busy.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - thread, mutex, condition_variable, atomic: For the worker threads and queues.
+ *   - vector, memory: For the per-thread job ring buffers, owning queues and threads.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace KryptosEngine {
+
+    /**
+     * @class JobSystem
+     * @brief Singleton work-stealing thread pool.
+     *
+     * Work is submitted as a range that is split into chunks. The calling thread takes part in
+     * executing the chunks and returns once every chunk has finished. Jobs must not throw.
+     */
+    class JobSystem {
+    private:
+        /**
+         * @brief A chunk of a parallel range.
+         *
+         * Jobs are plain data, copied into ring buffers that only grow, so once every queue
+         * has held a frame's peak number of jobs, submitting work no longer allocates.
+         */
+        struct Job {
+            void (*function)(void* context, std::size_t begin, std::size_t end); ///< Range body to invoke.
+            void* context;                                                       ///< Body object passed to the function.
+            std::size_t begin;                                                   ///< First index of the chunk.
+            std::size_t end;                                                     ///< One past the last index of the chunk.
+            std::atomic<std::size_t>* remaining;                                 ///< Counter of unfinished chunks in the range.
+        };
+
+        /**
+         * @brief Work queue owned by one thread.
+         *
+         * A ring buffer whose capacity is a power of two, doubled when full. The owner pops from
+         * the back; other threads steal from the front.
+         */
+        struct WorkQueue {
+            std::mutex mutex;       ///< Guards the ring buffer.
+            std::vector<Job> jobs;  ///< Ring buffer of pending jobs.
+            std::size_t head = 0;   ///< Position of the oldest pending job.
+            std::size_t count = 0;  ///< Number of pending jobs.
+
+            /**
+             * @brief Queues a job after the newest one, growing the buffer if it is full.
+             */
+            void pushBack(const Job& job);
+
+            /**
+             * @brief Takes the newest job.
+             * @return False if the queue is empty.
+             */
+            bool popBack(Job& job);
+
+            /**
+             * @brief Takes the oldest job.
+             * @return False if the queue is empty.
+             */
+            bool popFront(Job& job);
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> queues; ///< Queue 0 belongs to external threads, the rest to workers.
+        std::vector<std::thread> workers;               ///< Worker threads.
+        std::atomic<bool> running;                      ///< Cleared to stop the workers.
+        std::atomic<std::size_t> pendingJobs;           ///< Number of queued jobs across all queues.
+        std::mutex wakeMutex;                           ///< Mutex paired with the wake condition.
+        std::condition_variable wakeCondition;          ///< Signalled when jobs are queued or on shutdown.
+
+        /**
+         * @brief Private constructor to enforce singleton pattern.
+         * Starts one worker per hardware thread, minus the calling thread.
+         */
+        JobSystem();
+
+        /**
+         * @brief Stops and joins every worker thread.
+         */
+        ~JobSystem();
+
+        /**
+         * @brief Main loop of a worker thread.
+         * @param queueIndex Index of the queue owned by the worker.
+         */
+        void workerLoop(std::size_t queueIndex);
+
+        /**
+         * @brief Takes a job from the thread's own queue, or steals one from another queue.
+         * @param queueIndex Index of the queue owned by the calling thread.
+         * @param job Receives the job on success.
+         * @return True if a job was taken.
+         */
+        bool takeJob(std::size_t queueIndex, Job& job);
+
+        /**
+         * @brief Executes a job and marks its chunk as finished.
+         * @param job The job to execute.
+         */
+        static void execute(const Job& job);
+
+        /**
+         * @brief Splits a range into jobs, queues them and helps until they finish.
+         * @param count Number of indices in the range.
+         * @param chunkSize Maximum number of indices per job.
+         * @param function Range body to invoke for each chunk.
+         * @param context Body object passed to the function.
+         */
+        void dispatch(std::size_t count, std::size_t chunkSize,
+            void (*function)(void*, std::size_t, std::size_t), void* context);
+
+    public:
+        /**
+         * @brief Deleted copy constructor to prevent copying the singleton instance.
+         */
+        JobSystem(const JobSystem&) = delete;
+
+        /**
+         * @brief Deleted assignment operator to prevent copying the singleton instance.
+         */
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Provides access to the singleton instance of JobSystem.
+         * The worker threads are started on first use.
+         * @return A reference to the singleton instance.
+         */
+        static JobSystem& getInstance();
+
+        /**
+         * @brief Gets the number of threads that execute jobs, including the caller.
+         * @return The worker count plus one.
+         */
+        std::size_t getThreadCount() const;
+
+        /**
+         * @brief Gets the index of the calling thread among the threads that execute jobs.
+         *
+         * Workers have indices 1 to getThreadCount() - 1. Every other thread, including the one
+         * submitting work, has index 0, so per-thread data indexed this way is only private to
+         * a thread while a single external thread submits work.
+         * @return A value in [0, getThreadCount()).
+         */
+        static std::size_t getCurrentThreadIndex();
+
+        /**
+         * @brief Runs a body over the range [0, count) split into chunks.
+         *
+         * The body is called as `body(begin, end)` for disjoint chunks, possibly concurrently.
+         * The call blocks until every chunk has finished; the caller executes chunks while it waits.
+         * @tparam Body Callable taking `(std::size_t begin, std::size_t end)`.
+         * @param count Number of indices in the range.
+         * @param chunkSize Maximum number of indices per chunk.
+         * @param body The range body.
+         */
+        template <typename Body>
+        void parallelFor(std::size_t count, std::size_t chunkSize, Body&& body) {
+            using BodyType = std::remove_reference_t<Body>;
+            dispatch(count, chunkSize,
+                [](void* context, std::size_t begin, std::size_t end) {
+                    (*static_cast<BodyType*>(context))(begin, end);
+                },
+                const_cast<void*>(static_cast<const void*>(&body)));
+        }
+    };
+
+} // namespace KryptosEngine
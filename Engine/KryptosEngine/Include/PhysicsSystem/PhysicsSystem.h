@@ -0,0 +1,191 @@
+/*
+ * PhysicsSystem.h - Kryptos Rigid Body Physics
+ * --------------------------------------------
+ * Integrates the velocity and position of every active game object on a
+ * fixed timestep, applying gravity to objects with useGravity set and
+ * dividing accumulated forces by each object's mass. Collider overlaps
+ * are then found by the sweep-and-prune broadphase.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SweepAndPrune.h: Broadphase run after integration.
+ *   - SFML/Graphics.hpp: For vector types.
+ *   - cstddef: For body counts.
+ */
+
+#pragma once
+
+#include "SweepAndPrune.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class PhysicsSystem
+     * @brief Singleton fixed-timestep integrator over the GameObjectManager's TransformStore.
+     *
+     * Uses semi-implicit Euler integration: velocity is advanced first, then position is
+     * advanced with the new velocity. The integrator runs over the packed position, velocity,
+     * force, mass and gravity columns with SSE or AVX, split across the JobSystem. A scalar
+     * path that produces the same results is kept as a reference for validation.
+     */
+    class PhysicsSystem {
+    private:
+        /**
+         * @brief Pointers into the TransformStore columns of the bodies being integrated.
+         */
+        struct BodyArrays {
+            float* positionX;
+            float* positionY;
+            float* velocityX;
+            float* velocityY;
+            const float* forceX;
+            const float* forceY;
+            const float* mass;
+            const std::uint8_t* useGravity;
+        };
+
+        float fixedTimestep;           ///< Length of one physics step, in seconds.
+        float accumulator;             ///< Frame time not yet consumed by a physics step.
+        unsigned int maxStepsPerFrame; ///< Upper bound on steps per update, to avoid a spiral of death.
+        sf::Vector2f gravity;          ///< Gravitational acceleration, in units per second squared.
+        bool simdEnabled;              ///< Uses the SIMD integrator when true, the scalar one when false.
+        SweepAndPrune broadphase;      ///< Finds overlapping colliders after integration.
+
+        std::size_t lastBodyCount;         ///< Bodies integrated per step during the last update.
+        unsigned int lastStepCount;        ///< Steps taken during the last update.
+        float lastBodiesPerMillisecond;    ///< Measured throughput of the last update that stepped.
+
+        /**
+         * @brief Private constructor for Singleton pattern.
+         */
+        PhysicsSystem();
+
+        /**
+         * @brief Integrates bodies [begin, end) with plain scalar code.
+         */
+        static void integrateScalar(const BodyArrays& bodies, std::size_t begin, std::size_t end,
+            const sf::Vector2f& gravity, float step);
+
+        /**
+         * @brief Integrates bodies [begin, end) with SSE or AVX, finishing the tail with scalar code.
+         */
+        static void integrateSimd(const BodyArrays& bodies, std::size_t begin, std::size_t end,
+            const sf::Vector2f& gravity, float step);
+
+        /**
+         * @brief Runs one physics step over every active body.
+         * @param bodies The columns to integrate.
+         * @param count The number of active bodies.
+         */
+        void step(const BodyArrays& bodies, std::size_t count) const;
+
+    public:
+        PhysicsSystem(const PhysicsSystem&) = delete;
+        PhysicsSystem& operator=(const PhysicsSystem&) = delete;
+
+        /**
+         * @brief Gets the singleton instance of the PhysicsSystem.
+         * @return Reference to the singleton instance.
+         */
+        static PhysicsSystem& getInstance();
+
+        /**
+         * @brief Advances the simulation by a frame's worth of time.
+         *
+         * Runs as many fixed steps as the accumulated time allows, up to the per-frame limit,
+         * then clears accumulated forces and moves integrated bodies in the spatial index.
+         * The broadphase is updated every frame, since objects may also be moved directly.
+         * Must be called from the main thread, outside GameObjectManager::updateAll.
+         * @param deltaTime Time elapsed since the last frame.
+         */
+        void update(float deltaTime);
+
+        /**
+         * @brief Provides access to the collision broadphase.
+         * @return Reference to the broadphase; add colliders to it and read its events after update().
+         */
+        SweepAndPrune& getBroadphase() {
+            return broadphase;
+        }
+
+        const SweepAndPrune& getBroadphase() const {
+            return broadphase;
+        }
+
+        /**
+         * @brief Integrates the active range once with both paths and compares the results.
+         *
+         * The TransformStore is not modified.
+         * @return The largest absolute difference in position or velocity between the paths.
+         */
+        float validateSimd() const;
+
+        /**
+         * @brief Gets the name of the instruction set used by the SIMD path.
+         * @return "AVX", "SSE2" or "Scalar" if no SIMD support was compiled in.
+         */
+        static const char* getSimdInstructionSet();
+
+        void setFixedTimestep(float step) {
+            fixedTimestep = step;
+        }
+
+        float getFixedTimestep() const {
+            return fixedTimestep;
+        }
+
+        void setMaxStepsPerFrame(unsigned int steps) {
+            maxStepsPerFrame = steps;
+        }
+
+        void setGravity(const sf::Vector2f& acceleration) {
+            gravity = acceleration;
+        }
+
+        const sf::Vector2f& getGravity() const {
+            return gravity;
+        }
+
+        /**
+         * @brief Selects between the SIMD and the scalar reference integrator.
+         * @param enabled True to use SIMD.
+         */
+        void setSimdEnabled(bool enabled) {
+            simdEnabled = enabled;
+        }
+
+        bool getSimdEnabled() const {
+            return simdEnabled;
+        }
+
+        /**
+         * @brief Gets the fraction of a step left in the accumulator, for render interpolation.
+         * @return A value in [0, 1).
+         */
+        float getInterpolationAlpha() const {
+            return accumulator / fixedTimestep;
+        }
+
+        std::size_t getLastBodyCount() const {
+            return lastBodyCount;
+        }
+
+        unsigned int getLastStepCount() const {
+            return lastStepCount;
+        }
+
+        /**
+         * @brief Gets the integrator throughput measured during the last update that stepped.
+         * @return Bodies integrated per millisecond, counting each step separately.
+         */
+        float getBodiesPerMillisecond() const {
+            return lastBodiesPerMillisecond;
+        }
+    };
+
+} // namespace KryptosEngine
@@ -0,0 +1,181 @@
+/*
+ * SweepAndPrune.h - Kryptos Sweep-and-Prune Broadphase
+ * ----------------------------------------------------
+ * Finds overlapping collider bounds between game objects by keeping the
+ * bounds' X extents in a sorted endpoint list. Because most objects barely
+ * move between frames, the list is nearly sorted and is restored with an
+ * insertion sort in close to linear time.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - GameObjectHandle.h: Colliders are keyed by game object handle.
+ *   - SFML/Graphics.hpp: For rectangle types.
+ *   - vector: For proxies, endpoints and the pair cache.
+ */
+
+#pragma once
+
+#include "../GameObjectSystem/GameObjectHandle.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace KryptosEngine {
+
+    /**
+     * @brief Reported when two colliders start or stop overlapping.
+     */
+    struct CollisionEvent {
+        enum class Type : std::uint8_t {
+            BeginOverlap,  ///< The colliders overlap this frame but did not last frame.
+            EndOverlap     ///< The colliders overlapped last frame but no longer do.
+        };
+
+        Type type;                ///< Whether the overlap began or ended.
+        GameObjectHandle first;   ///< One object of the pair.
+        GameObjectHandle second;  ///< The other object of the pair.
+    };
+
+    /**
+     * @class SweepAndPrune
+     * @brief Incremental sweep-and-prune broadphase with a persistent overlapping-pair cache.
+     *
+     * Each collider is an axis-aligned box given relative to its object's position. Every
+     * update re-sorts the X endpoints, sweeps them to collect the pairs that also overlap on Y,
+     * and compares the result with last frame's pairs to produce begin and end events.
+     * Inactive objects take part in no pairs; destroyed objects are dropped automatically.
+     */
+    class SweepAndPrune {
+    private:
+        /**
+         * @brief Broadphase record of one collider.
+         */
+        struct Proxy {
+            GameObjectHandle handle;    ///< Object the collider belongs to, or a null handle when free.
+            sf::FloatRect localBounds;  ///< Bounds relative to the object's position.
+            float minX, minY;           ///< World-space bounds from the last update.
+            float maxX, maxY;
+            bool enabled;               ///< False while the object is inactive or the collider is removed.
+            bool live;                  ///< False once the collider is removed; the proxy is freed by the next update.
+            std::uint32_t sweepIndex;   ///< Position in the open list during a sweep.
+        };
+
+        /**
+         * @brief One end of a proxy's X extent. The low bit of `data` marks a max endpoint.
+         */
+        struct Endpoint {
+            float value;         ///< Cached X coordinate of the endpoint.
+            std::uint32_t data;  ///< Proxy index shifted left by one, with the max flag in bit 0.
+        };
+
+        std::vector<Proxy> proxies;               ///< Proxy storage; free entries are recycled.
+        std::vector<std::uint32_t> freeProxies;   ///< Indices of free proxies.
+        std::vector<std::uint32_t> releasedProxies; ///< Removed proxies still holding endpoints until the next update.
+        std::vector<std::uint32_t> proxyBySlot;   ///< Proxy index by handle slot, or InvalidIndex.
+        std::vector<Endpoint> endpoints;          ///< X endpoints of every proxy, kept sorted.
+        std::vector<std::uint64_t> pairs;         ///< Overlapping pairs from the last update, sorted.
+        std::vector<std::uint64_t> currentPairs;  ///< Scratch list of pairs found by the current sweep.
+        std::vector<std::uint32_t> openProxies;   ///< Scratch list of proxies open during a sweep.
+        std::vector<CollisionEvent> events;       ///< Events produced by the last update.
+        std::size_t unsortedEndpoints = 0;        ///< Endpoints appended since the last sort.
+
+        /**
+         * @brief Packs two proxy indices into an order-independent pair key.
+         */
+        static std::uint64_t pairKey(std::uint32_t a, std::uint32_t b);
+
+        /**
+         * @brief Orders endpoints by value, with min endpoints first on ties so touching boxes overlap.
+         */
+        static bool endpointLess(const Endpoint& a, const Endpoint& b);
+
+        /**
+         * @brief Appends an event for a pair key.
+         */
+        void emit(CollisionEvent::Type type, std::uint64_t key);
+
+        /**
+         * @brief Detaches a proxy from its object. It is freed by the next update.
+         */
+        void releaseProxy(std::uint32_t proxyIndex);
+
+        /**
+         * @brief Removes the endpoints of released proxies and makes the proxies reusable.
+         */
+        void freeReleasedProxies();
+
+        /**
+         * @brief Refreshes every proxy's world bounds from the TransformStore.
+         */
+        void refreshBounds();
+
+        /**
+         * @brief Restores endpoint order, with an insertion sort unless many endpoints were added.
+         */
+        void sortEndpoints();
+
+        /**
+         * @brief Sweeps the endpoints and collects the overlapping pairs into currentPairs.
+         */
+        void sweep();
+
+    public:
+        /**
+         * @brief Adds a collider to an object, or replaces its existing bounds.
+         * @param handle The object's handle.
+         * @param localBounds The collider bounds relative to the object's position.
+         */
+        void addCollider(GameObjectHandle handle, const sf::FloatRect& localBounds);
+
+        /**
+         * @brief Removes an object's collider.
+         *
+         * End events for the overlaps it was part of are emitted by the next update.
+         * @param handle The object's handle.
+         */
+        void removeCollider(GameObjectHandle handle);
+
+        /**
+         * @brief Checks whether an object has a collider.
+         * @param handle The object's handle.
+         * @return True if the object has a collider.
+         */
+        bool hasCollider(GameObjectHandle handle) const;
+
+        /**
+         * @brief Updates the broadphase from current object positions.
+         *
+         * Replaces the event list with the overlaps that began or ended since the last update.
+         * Must be called from the main thread, outside GameObjectManager::updateAll.
+         */
+        void update();
+
+        /**
+         * @brief Gets the events produced by the last update.
+         * @return Begin and end events, ordered by pair.
+         */
+        const std::vector<CollisionEvent>& getEvents() const {
+            return events;
+        }
+
+        /**
+         * @brief Gets the number of overlapping pairs found by the last update.
+         * @return The size of the pair cache.
+         */
+        std::size_t getPairCount() const {
+            return pairs.size();
+        }
+
+        /**
+         * @brief Gets the number of colliders in the broadphase.
+         * @return The number of live proxies.
+         */
+        std::size_t getColliderCount() const {
+            return proxies.size() - freeProxies.size() - releasedProxies.size();
+        }
+    };
+
+} // namespace KryptosEngine
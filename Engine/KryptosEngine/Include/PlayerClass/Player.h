@@ -17,6 +17,7 @@
 
 #include "../GameObjectSystem/GameObject.h"
 #include "../SpriteRenderingSystem/SpriteRenderer.h"
+#include <tuple>
 
  /**
   * @class Player
@@ -33,8 +34,19 @@ private:
     float attackMultiplier;         ///< Multiplier for attack damage.
     float jumpMultiplier;           ///< Multiplier for jump height.
     SpriteRenderer spriteRenderer;  ///< Renders the player's sprite.
+    std::string texturePath;        ///< Texture loaded once the player is registered.
+
+    /**
+     * @brief Sets the player's collider to the bounds of the sprite currently shown.
+     */
+    void fitColliderToSprite();
 
 public:
+    /**
+     * @brief Components of the player, for GameObjectManager::view.
+     */
+    static constexpr auto Components = std::make_tuple(&Player::spriteRenderer);
+
     /**
      * @brief Constructs a Player object.
      *
@@ -54,7 +66,12 @@ public:
      * @brief Updates the player's logic.
      * @param deltaTime Time elapsed since the last frame, used for time-based updates.
      */
-    void update(float deltaTime);
+    void update(float deltaTime) override;
+
+    /**
+     * @brief Starts loading the player's texture and adds its collider, once the player has a handle.
+     */
+    void onRegistered() override;
 
     /**
      * @brief Renders the player to the given window.
@@ -0,0 +1,183 @@
+/*
+ * SceneGraph.h - Kryptos Transform Hierarchy
+ * ------------------------------------------
+ * Lets game objects be attached to each other. A child keeps a transform
+ * relative to its parent, and its world transform in the TransformStore is
+ * recomputed whenever the parent or the child's local transform changes.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - GameObjectHandle.h: Nodes are keyed by game object handle.
+ *   - SFML/Graphics.hpp: For vector and angle types.
+ *   - vector: For node storage.
+ */
+
+#pragma once
+
+#include "../GameObjectSystem/GameObjectHandle.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class SceneGraph
+     * @brief Singleton parent/child hierarchy over game object transforms.
+     *
+     * Only objects that have a parent or children are stored. Nodes are laid out one tree after
+     * another, each tree in breadth-first order, so parents precede their children, siblings are
+     * contiguous and a pass over a tree walks memory linearly. Separate trees are independent
+     * and are updated in parallel on the JobSystem.
+     *
+     * A root's world transform is the position and rotation in the TransformStore, so moving a
+     * root with GameObject::setPosition moves its whole tree. A child's world transform is
+     * derived from its local transform and overwritten whenever it is recomputed; move children
+     * with setLocalPosition and setLocalRotation.
+     */
+    class SceneGraph {
+    private:
+        /**
+         * @brief A node of the hierarchy.
+         */
+        struct Node {
+            GameObjectHandle handle;      ///< Object the node belongs to.
+            std::uint32_t parent;         ///< Index of the parent node, or InvalidIndex for a root.
+            std::uint32_t firstChild;     ///< Index of the first child; children are contiguous.
+            std::uint32_t childCount;     ///< Number of children.
+            float localX, localY;         ///< Position relative to the parent.
+            float localRotation;          ///< Rotation relative to the parent, in radians.
+            float worldX, worldY;         ///< World position from the last update.
+            float worldRotation;          ///< World rotation from the last update, in radians.
+            float worldCos, worldSin;     ///< Cosine and sine of the world rotation.
+            std::uint32_t movedPass;      ///< Last update pass in which the world transform changed.
+            bool dirty;                   ///< True when the local transform changed since the last update.
+        };
+
+        std::vector<Node> nodes;                  ///< Nodes, one tree after another in breadth-first order.
+        std::vector<std::uint32_t> treeStarts;    ///< Index of each tree's root; a tree ends where the next begins.
+        std::vector<std::uint32_t> nodeBySlot;    ///< Node index by handle slot, or InvalidIndex.
+        bool structureDirty = false;              ///< True when nodes were attached or detached since the last layout.
+        std::uint32_t pass = 0;                   ///< Number of update passes run.
+
+        /**
+         * @brief Private constructor for Singleton pattern.
+         */
+        SceneGraph() = default;
+
+        /**
+         * @brief Finds the node of a live handle.
+         * @return Index of the node, or InvalidIndex if the object is not in the graph.
+         */
+        std::uint32_t findNode(GameObjectHandle handle) const;
+
+        /**
+         * @brief Finds the node of an object, adding a root node for it if needed.
+         * @return Index of the node.
+         */
+        std::uint32_t acquireNode(GameObjectHandle handle);
+
+        /**
+         * @brief Drops nodes of destroyed objects, orphaning their children.
+         * @return True if any node was dropped.
+         */
+        bool removeDeadNodes();
+
+        /**
+         * @brief Reorders the nodes into per-tree breadth-first layout, dropping lone nodes.
+         */
+        void rebuildLayout();
+
+        /**
+         * @brief Recomputes the world transforms of one tree.
+         * @param begin Index of the tree's root.
+         * @param end One past the tree's last node.
+         */
+        void updateTree(std::size_t begin, std::size_t end);
+
+    public:
+        SceneGraph(const SceneGraph&) = delete;
+        SceneGraph& operator=(const SceneGraph&) = delete;
+
+        /**
+         * @brief Gets the singleton instance of the SceneGraph.
+         * @return Reference to the singleton instance.
+         */
+        static SceneGraph& getInstance();
+
+        /**
+         * @brief Attaches an object to a parent, keeping its current world transform.
+         *
+         * The child's local transform is derived from the world transforms of both objects in
+         * the TransformStore, which for children are as of the last update. Attaching to a null
+         * handle detaches the object.
+         * @param child The object to attach.
+         * @param parent The new parent.
+         * @throw std::logic_error if the attachment would create a cycle.
+         */
+        void attach(GameObjectHandle child, GameObjectHandle parent);
+
+        /**
+         * @brief Detaches an object from its parent, keeping its current world transform.
+         * @param child The object to detach. Its own children stay attached to it.
+         */
+        void detach(GameObjectHandle child);
+
+        /**
+         * @brief Gets an object's parent.
+         * @return The parent's handle, or a null handle if the object has no parent.
+         */
+        GameObjectHandle getParent(GameObjectHandle child) const;
+
+        /**
+         * @brief Collects an object's children.
+         * @param parent The object whose children to collect.
+         * @param results Receives the children's handles.
+         */
+        void getChildren(GameObjectHandle parent, std::vector<GameObjectHandle>& results) const;
+
+        /**
+         * @brief Sets an object's position relative to its parent.
+         *
+         * For an object without a parent this is its world position.
+         */
+        void setLocalPosition(GameObjectHandle object, const sf::Vector2f& position);
+
+        /**
+         * @brief Gets an object's position relative to its parent.
+         */
+        sf::Vector2f getLocalPosition(GameObjectHandle object) const;
+
+        /**
+         * @brief Sets an object's rotation relative to its parent.
+         *
+         * For an object without a parent this is its world rotation.
+         */
+        void setLocalRotation(GameObjectHandle object, const sf::Angle& rotation);
+
+        /**
+         * @brief Gets an object's rotation relative to its parent.
+         */
+        sf::Angle getLocalRotation(GameObjectHandle object) const;
+
+        /**
+         * @brief Recomputes world transforms for every subtree whose root moved or whose local
+         * transforms changed, and writes them to the TransformStore.
+         *
+         * Run once per frame after object updates and physics, from the main thread, outside
+         * GameObjectManager::updateAll.
+         */
+        void update();
+
+        /**
+         * @brief Gets the number of objects in the hierarchy.
+         * @return The number of nodes.
+         */
+        std::size_t getNodeCount() const {
+            return nodes.size();
+        }
+    };
+
+} // namespace KryptosEngine
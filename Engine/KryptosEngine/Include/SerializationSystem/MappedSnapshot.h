@@ -0,0 +1,136 @@
+/*
+ * MappedSnapshot.h - Kryptos Memory-Mapped World Snapshot
+ * -------------------------------------------------------
+ * Defines the MappedSnapshot class, which maps a world snapshot file into
+ * memory read-only and exposes its arrays in place. Opening a snapshot
+ * validates the header and section bounds once; no field is parsed or
+ * copied.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SnapshotFormat.h: Layout of the snapshot file.
+ *   - GameObjectHandle.h: Snapshots record each object's handle.
+ *   - string, string_view: For the file path and names.
+ */
+
+#pragma once
+
+#include "SnapshotFormat.h"
+#include "../GameObjectSystem/GameObjectHandle.h"
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class MappedSnapshot
+     * @brief Read-only view of a world snapshot file mapped into memory.
+     *
+     * Uses a file mapping on Windows and mmap elsewhere, so pages are only read from disk
+     * when touched. The arrays returned by the getters point into the mapping and stay
+     * valid for the lifetime of the MappedSnapshot. Movable, not copyable.
+     */
+    class MappedSnapshot {
+    private:
+        const std::byte* data = nullptr;  ///< Start of the mapping.
+        std::size_t size = 0;             ///< Size of the mapping, in bytes.
+#ifdef _WIN32
+        void* file = nullptr;             ///< Handle of the open file.
+        void* mapping = nullptr;          ///< Handle of the file mapping object.
+#endif
+
+        /**
+         * @brief Checks the header and that every section lies inside the file.
+         * @throw std::runtime_error if the snapshot is malformed or from another version.
+         */
+        void validate() const;
+
+        /**
+         * @brief Unmaps the file and closes it.
+         */
+        void release();
+
+        /**
+         * @brief Gets a typed pointer to a section.
+         * @param offset Offset of the section from the start of the file.
+         */
+        template <typename T>
+        const T* section(std::uint64_t offset) const {
+            return reinterpret_cast<const T*>(data + offset);
+        }
+
+    public:
+        /**
+         * @brief Maps a snapshot file.
+         * @param path Path of the file to map.
+         * @throw std::runtime_error if the file cannot be mapped or is not a valid snapshot.
+         */
+        explicit MappedSnapshot(const std::string& path);
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedSnapshot();
+
+        MappedSnapshot(MappedSnapshot&& other) noexcept;
+        MappedSnapshot& operator=(MappedSnapshot&& other) noexcept;
+        MappedSnapshot(const MappedSnapshot&) = delete;
+        MappedSnapshot& operator=(const MappedSnapshot&) = delete;
+
+        /**
+         * @brief Gets the snapshot's header.
+         * @return The header, in place.
+         */
+        const SnapshotHeader& getHeader() const {
+            return *section<SnapshotHeader>(0);
+        }
+
+        /**
+         * @brief Gets the number of objects in the snapshot.
+         */
+        std::size_t getObjectCount() const {
+            return static_cast<std::size_t>(getHeader().objectCount);
+        }
+
+        /**
+         * @brief Gets the number of active objects, which come first in every array.
+         */
+        std::size_t getActiveCount() const {
+            return static_cast<std::size_t>(getHeader().activeCount);
+        }
+
+        /**
+         * @brief Gets an object's name.
+         * @param object Index of the object in the snapshot.
+         * @return A view of the name inside the mapping.
+         */
+        std::string_view getName(std::size_t object) const {
+            const std::uint32_t* offsets = section<std::uint32_t>(getHeader().nameOffsets);
+            const std::uint32_t name = section<std::uint32_t>(getHeader().nameIndices)[object];
+            return std::string_view(section<char>(getHeader().nameData) + offsets[name], offsets[name + 1] - offsets[name]);
+        }
+
+        /**
+         * @brief Gets the handle an object had when the snapshot was saved.
+         * @param object Index of the object in the snapshot.
+         */
+        GameObjectHandle getHandle(std::size_t object) const {
+            return { section<std::uint32_t>(getHeader().handleIndices)[object],
+                section<std::uint32_t>(getHeader().handleGenerations)[object] };
+        }
+
+        // Per-object arrays, each getObjectCount() entries long
+        const float* getPositionX() const { return section<float>(getHeader().positionX); }
+        const float* getPositionY() const { return section<float>(getHeader().positionY); }
+        const float* getRotation() const { return section<float>(getHeader().rotation); }
+        const float* getVelocityX() const { return section<float>(getHeader().velocityX); }
+        const float* getVelocityY() const { return section<float>(getHeader().velocityY); }
+        const float* getMass() const { return section<float>(getHeader().mass); }
+        const std::uint8_t* getUseGravity() const { return section<std::uint8_t>(getHeader().useGravity); }
+    };
+
+} // namespace KryptosEngine
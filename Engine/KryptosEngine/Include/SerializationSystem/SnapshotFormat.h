@@ -0,0 +1,79 @@
+/*
+ * SnapshotFormat.h - Kryptos World Snapshot File Layout
+ * -----------------------------------------------------
+ * Defines the on-disk layout of a world snapshot. A snapshot is a header
+ * followed by a name table and one packed array per object field. Every
+ * section is located by a byte offset from the start of the file, so the
+ * file can be mapped at any address and read in place without parsing.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - cstdint: For fixed-width field types.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace KryptosEngine {
+
+    /**
+     * @struct SnapshotHeader
+     * @brief First bytes of a world snapshot file.
+     *
+     * Objects are stored in the GameObjectManager's dense order, so the first `activeCount`
+     * objects were active. Each per-object array holds `objectCount` entries. The name table
+     * holds each distinct name once: `nameOffsets` has `nameCount + 1` entries, and name `n`
+     * is the bytes [nameOffsets[n], nameOffsets[n + 1]) of `nameData`, without a terminator.
+     * All offsets are in bytes from the start of the file and aligned to SnapshotSectionAlignment.
+     */
+    struct SnapshotHeader {
+        char magic[8];                  ///< Always SnapshotMagic.
+        std::uint32_t version;          ///< Format version, SnapshotVersion when written.
+        std::uint32_t byteOrder;        ///< SnapshotByteOrder as written by the saving machine.
+        std::uint64_t fileSize;         ///< Total size of the file, in bytes.
+        std::uint64_t objectCount;      ///< Number of objects.
+        std::uint64_t activeCount;      ///< Number of active objects at the front of the arrays.
+        std::uint64_t nameCount;        ///< Number of distinct names.
+        std::uint64_t nameOffsets;      ///< std::uint32_t[nameCount + 1]: start of each name in nameData.
+        std::uint64_t nameData;         ///< char[]: the name bytes.
+        std::uint64_t nameIndices;      ///< std::uint32_t[objectCount]: name table entry of each object.
+        std::uint64_t handleIndices;    ///< std::uint32_t[objectCount]: handle slot index of each object.
+        std::uint64_t handleGenerations; ///< std::uint32_t[objectCount]: handle generation of each object.
+        std::uint64_t positionX;        ///< float[objectCount]: X position.
+        std::uint64_t positionY;        ///< float[objectCount]: Y position.
+        std::uint64_t rotation;         ///< float[objectCount]: rotation, in radians.
+        std::uint64_t velocityX;        ///< float[objectCount]: X velocity.
+        std::uint64_t velocityY;        ///< float[objectCount]: Y velocity.
+        std::uint64_t mass;             ///< float[objectCount]: mass.
+        std::uint64_t useGravity;       ///< std::uint8_t[objectCount]: non-zero if affected by gravity.
+    };
+
+    static_assert(std::is_trivially_copyable_v<SnapshotHeader>, "SnapshotHeader is written with a single copy");
+    static_assert(sizeof(SnapshotHeader) == 144, "SnapshotHeader layout must not depend on padding");
+
+    /**
+     * @brief Identifies a world snapshot file.
+     */
+    constexpr char SnapshotMagic[8] = { 'K', 'R', 'Y', 'P', 'S', 'N', 'A', 'P' };
+
+    /**
+     * @brief Current format version. Bump it whenever the layout changes.
+     */
+    constexpr std::uint32_t SnapshotVersion = 1;
+
+    /**
+     * @brief Written in native byte order; reads back differently on a machine of the other order.
+     */
+    constexpr std::uint32_t SnapshotByteOrder = 0x01020304u;
+
+    /**
+     * @brief Alignment of every section, enough for aligned SIMD loads from a mapped file.
+     */
+    constexpr std::size_t SnapshotSectionAlignment = 16;
+
+} // namespace KryptosEngine
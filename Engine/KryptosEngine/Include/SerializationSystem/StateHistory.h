@@ -0,0 +1,227 @@
+/*
+ * StateHistory.h - Kryptos Frame History
+ * --------------------------------------
+ * Keeps the last frames of game object state in preallocated ring buffers
+ * so the world can be rewound to a recent frame and re-simulated forward,
+ * for debugging desyncs and for rollback.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - GameObjectManager.h: Source of the change list and object state.
+ *   - vector: For the preallocated buffers.
+ */
+
+#pragma once
+
+#include "../GameObjectSystem/GameObjectManager.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class StateHistory
+     * @brief Ring buffer of per-frame state deltas.
+     *
+     * Each captured frame stores, for every object that changed during it, the object's state
+     * before the change. Unchanged objects cost nothing, so capture follows the
+     * GameObjectManager's change list rather than the world size. Rewinding applies the stored
+     * states newest first. A shadow copy of each object's last captured state supplies the
+     * "before" values without reading back through older frames.
+     *
+     * Both buffers are allocated up front; when either is full the oldest frames are dropped.
+     * Only the shadow grows, when the registry gains new slots.
+     *
+     * The history covers transform, physics and active state. Objects spawned or destroyed
+     * within the history are not destroyed or recreated by a rewind; records for objects that
+     * no longer exist are skipped.
+     */
+    class StateHistory {
+    private:
+        /**
+         * @brief Captured state of one object.
+         */
+        struct ObjectState {
+            float positionX, positionY;  ///< Position.
+            float rotation;              ///< Rotation, in radians.
+            float velocityX, velocityY;  ///< Velocity.
+            float mass;                  ///< Mass.
+            std::uint8_t useGravity;     ///< Non-zero if affected by gravity.
+            std::uint8_t active;         ///< Non-zero if active.
+        };
+
+        /**
+         * @brief An object's state before it changed during a frame.
+         */
+        struct Record {
+            GameObjectHandle handle;  ///< Object the record belongs to.
+            ObjectState before;       ///< State as of the previous captured frame.
+        };
+
+        /**
+         * @brief A captured frame and its range in the record ring.
+         */
+        struct Frame {
+            std::uint32_t number;      ///< Frame number, from GameObjectManager::getChangeFrame.
+            float deltaTime;           ///< Frame time passed to capture, for re-simulation.
+            std::size_t firstRecord;   ///< Index of the frame's first record in the ring.
+            std::size_t recordCount;   ///< Number of records.
+        };
+
+        std::vector<Frame> frames;                ///< Frame ring, frameCapacity entries.
+        std::size_t oldestFrame = 0;              ///< Ring index of the oldest frame.
+        std::size_t frameCount = 0;               ///< Number of buffered frames.
+
+        std::vector<Record> records;              ///< Record ring, recordCapacity entries.
+        std::size_t oldestRecord = 0;             ///< Ring index of the oldest record.
+        std::size_t recordCount = 0;              ///< Number of buffered records.
+
+        std::vector<GameObjectHandle> shadowHandles; ///< Object each shadow entry belongs to, by slot.
+        std::vector<ObjectState> shadowStates;       ///< State of each object at the last capture, by slot.
+
+        std::vector<float> replaySteps;           ///< Time steps of the frames being re-simulated.
+
+        /**
+         * @brief Reads an object's current state.
+         */
+        static ObjectState readState(GameObjectHandle handle);
+
+        /**
+         * @brief Applies a state to a live object through its setters.
+         */
+        static void applyState(GameObjectHandle handle, const ObjectState& state);
+
+        /**
+         * @brief Stores an object's current state as its shadow.
+         */
+        void updateShadow(GameObjectHandle handle, const ObjectState& state);
+
+        /**
+         * @brief Drops the oldest buffered frame.
+         */
+        void dropOldestFrame();
+
+        /**
+         * @brief Gets a buffered frame by age.
+         * @param age 0 for the oldest frame.
+         */
+        Frame& frameAt(std::size_t age) {
+            return frames[(oldestFrame + age) % frames.size()];
+        }
+
+        const Frame& frameAt(std::size_t age) const {
+            return frames[(oldestFrame + age) % frames.size()];
+        }
+
+    public:
+        /**
+         * @brief Creates a history and takes the current world as its baseline.
+         * @param frameCapacity Maximum number of frames kept.
+         * @param recordCapacity Maximum number of changed-object records kept across all frames.
+         * @throw std::invalid_argument if either capacity is zero.
+         */
+        StateHistory(std::size_t frameCapacity, std::size_t recordCapacity);
+
+        StateHistory(const StateHistory&) = delete;
+        StateHistory& operator=(const StateHistory&) = delete;
+
+        /**
+         * @brief Forgets every buffered frame and takes the current world as the new baseline.
+         *
+         * Runs over every object; the only capture cost that depends on world size.
+         */
+        void reset();
+
+        /**
+         * @brief Records the changes made during the current frame.
+         *
+         * Call once per frame after every system has run and before
+         * GameObjectManager::clearChanges, from the main thread. If a frame changes more
+         * objects than the record buffer holds, the history is emptied and restarts after it.
+         * @param deltaTime The frame's time step, kept for re-simulation.
+         */
+        void capture(float deltaTime);
+
+        /**
+         * @brief Rewinds the world to the state it had when a buffered frame was captured.
+         *
+         * Changes made since the last capture are undone as well. Frames newer than the
+         * restored one are dropped, so the restored frame becomes the newest. Must be called
+         * from the main thread, outside GameObjectManager::updateAll.
+         * @param frameNumber A frame number between getOldestFrame and getNewestFrame.
+         * @return False if the frame is not buffered, in which case nothing changes.
+         */
+        bool restore(std::uint32_t frameNumber);
+
+        /**
+         * @brief Rewinds to a buffered frame and simulates the following frames again.
+         *
+         * The frames after `frameNumber` are replayed with their recorded time steps: for each
+         * one, `step(deltaTime)` runs the simulation, then the frame is captured and the
+         * frame's changes are cleared. Replayed frames are captured under new frame numbers.
+         * Inputs and other external state are the step function's responsibility.
+         * @tparam StepFunction Callable taking `(float deltaTime)`, e.g. running updateAll
+         * and the physics and scene graph updates.
+         * @param frameNumber The frame to rewind to.
+         * @param step Simulates one frame.
+         * @return False if the frame is not buffered, in which case nothing changes.
+         */
+        template <typename StepFunction>
+        bool resimulate(std::uint32_t frameNumber, StepFunction&& step) {
+            // Keep the time steps of the frames that restore is about to drop
+            replaySteps.clear();
+            for (std::size_t age = 0; age < frameCount; ++age) {
+                if (frameAt(age).number > frameNumber) {
+                    replaySteps.push_back(frameAt(age).deltaTime);
+                }
+            }
+
+            if (!restore(frameNumber)) {
+                return false;
+            }
+
+            GameObjectManager& manager = GameObjectManager::getInstance();
+            manager.clearChanges();
+            for (float deltaTime : replaySteps) {
+                step(deltaTime);
+                capture(deltaTime);
+                manager.clearChanges();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of buffered frames.
+         */
+        std::size_t getFrameCount() const {
+            return frameCount;
+        }
+
+        /**
+         * @brief Gets the number of the oldest buffered frame.
+         * @return The frame number, or zero if no frame is buffered.
+         */
+        std::uint32_t getOldestFrame() const {
+            return frameCount > 0 ? frameAt(0).number : 0;
+        }
+
+        /**
+         * @brief Gets the number of the newest buffered frame.
+         * @return The frame number, or zero if no frame is buffered.
+         */
+        std::uint32_t getNewestFrame() const {
+            return frameCount > 0 ? frameAt(frameCount - 1).number : 0;
+        }
+
+        /**
+         * @brief Gets the number of buffered change records, for statistics.
+         */
+        std::size_t getRecordCount() const {
+            return recordCount;
+        }
+    };
+
+} // namespace KryptosEngine
@@ -0,0 +1,59 @@
+/*
+ * WorldSnapshot.h - Kryptos World Snapshots
+ * -----------------------------------------
+ * Saves the state of every registered game object to a binary snapshot
+ * file, and restores saved state onto live objects for checkpoints.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - MappedSnapshot.h: Snapshots are read back through a file mapping.
+ *   - string: For file paths.
+ */
+
+#pragma once
+
+#include "MappedSnapshot.h"
+#include <string>
+#include <cstddef>
+
+namespace KryptosEngine {
+
+    /**
+     * @class WorldSnapshot
+     * @brief Writes and restores world snapshots in the SnapshotFormat layout.
+     *
+     * Snapshots record each object's name, handle, transform and physics properties, and
+     * whether it was active. They do not record an object's type or its own members, so
+     * loading a level means mapping a snapshot and spawning objects from its arrays, while
+     * a checkpoint is rolled back with restore.
+     */
+    class WorldSnapshot {
+    public:
+        WorldSnapshot() = delete;
+
+        /**
+         * @brief Saves every registered game object to a snapshot file.
+         *
+         * The snapshot is assembled in memory and written with a single write. Must be called
+         * from the main thread, outside GameObjectManager::updateAll.
+         * @param path Path of the file to write; an existing file is replaced.
+         * @throw std::runtime_error if the file cannot be written.
+         */
+        static void save(const std::string& path);
+
+        /**
+         * @brief Restores saved state onto the objects that are still alive.
+         *
+         * Objects are matched by handle and must still have the same name; objects destroyed
+         * since the snapshot was taken are skipped. State is applied through the GameObject
+         * setters, so the spatial index and change tracking see it. Must be called from the
+         * main thread, outside GameObjectManager::updateAll.
+         * @param snapshot A mapped snapshot.
+         * @return The number of objects restored.
+         */
+        static std::size_t restore(const MappedSnapshot& snapshot);
+    };
+
+} // namespace KryptosEngine
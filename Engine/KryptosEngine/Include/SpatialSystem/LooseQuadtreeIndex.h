@@ -0,0 +1,122 @@
+/*
+ * LooseQuadtreeIndex.h - Kryptos Loose Quadtree
+ * ---------------------------------------------
+ * Spatial index that subdivides a fixed world area into a quadtree whose
+ * nodes accept objects anywhere within loosened bounds, so small movements
+ * rarely move an object between nodes.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SpatialIndex.h: Base interface for spatial indices.
+ */
+
+#pragma once
+
+#include "SpatialIndex.h"
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class LooseQuadtreeIndex
+     * @brief Loose quadtree over game object positions.
+     *
+     * Adapts to uneven object density: crowded areas subdivide, empty areas stay coarse.
+     * Each node's loose bounds are twice the size of its tight quadrant. Objects outside
+     * the world bounds are kept at the root.
+     * Measured with 100,000 objects (KryptosBench spatial), a UniformGridIndex with cells the
+     * size of the query radius inserted objects about twice as fast as this index and answered
+     * queries faster, nearest queries most of all, while moves cost about the same. Its lead on
+     * box and radius queries mostly disappeared with clustered objects. Prefer this index when
+     * no single cell size suits the queries.
+     */
+    class LooseQuadtreeIndex : public SpatialIndex {
+    private:
+        /**
+         * @brief Per-slot record of an indexed object.
+         */
+        struct Entry {
+            sf::Vector2f position;     ///< Last known position of the object.
+            std::uint32_t generation;  ///< Generation of the handle that was inserted.
+            std::uint32_t node;        ///< Index of the node holding the object, or InvalidIndex if absent.
+            std::uint32_t nodeIndex;   ///< Position of the object within its node.
+        };
+
+        /**
+         * @brief A quadtree node.
+         */
+        struct Node {
+            sf::Vector2f centre;               ///< Centre of the node's quadrant.
+            float halfSize;                    ///< Half the side length of the tight quadrant.
+            std::uint32_t depth;               ///< Depth below the root.
+            std::uint32_t firstChild;          ///< Index of the first of four children, or InvalidIndex for a leaf.
+            std::vector<std::uint32_t> slots;  ///< Slot indices of the objects stored in the node.
+        };
+
+        std::vector<Entry> entries;    ///< Object records, indexed by handle slot.
+        std::vector<Node> nodes;       ///< Node storage; node 0 is the root.
+        std::uint32_t maxDepth;        ///< Deepest level a node may be split to.
+        std::size_t nodeCapacity;      ///< Object count above which a leaf is split.
+        std::size_t objectCount;       ///< Number of indexed objects.
+
+        /**
+         * @brief Gets the half-size of a node's loose bounds.
+         */
+        static float looseHalfSize(const Node& node);
+
+        /**
+         * @brief Checks whether a point lies within a node's loose bounds.
+         */
+        static bool looseContains(const Node& node, const sf::Vector2f& point);
+
+        /**
+         * @brief Gets the squared distance from a point to a node's loose bounds.
+         */
+        static float looseDistanceSquared(const Node& node, const sf::Vector2f& point);
+
+        /**
+         * @brief Finds the deepest existing node that should hold a point.
+         * @return Index of the node.
+         */
+        std::uint32_t findNode(const sf::Vector2f& point) const;
+
+        /**
+         * @brief Stores an object in a node, splitting the node if it overflows.
+         * @param slot The object's slot index.
+         * @param nodeIndex The node to store the object in.
+         */
+        void link(std::uint32_t slot, std::uint32_t nodeIndex);
+
+        /**
+         * @brief Removes an object from its node.
+         * @param slot The object's slot index.
+         */
+        void unlink(std::uint32_t slot);
+
+        /**
+         * @brief Creates four children for a leaf and moves its objects into them where they fit.
+         * @param nodeIndex The leaf to split.
+         */
+        void split(std::uint32_t nodeIndex);
+
+    public:
+        /**
+         * @brief Constructs an empty quadtree covering a world area.
+         * @param worldBounds The area covered by the root. It is extended to a square if necessary.
+         * @param maxDepth The deepest level a node may be split to.
+         * @param nodeCapacity The object count above which a leaf is split.
+         */
+        LooseQuadtreeIndex(const sf::FloatRect& worldBounds, std::uint32_t maxDepth = 8, std::size_t nodeCapacity = 16);
+
+        void insert(GameObjectHandle handle, const sf::Vector2f& position) override;
+        void update(GameObjectHandle handle, const sf::Vector2f& position) override;
+        void remove(GameObjectHandle handle) override;
+        void clear() override;
+        void queryAABB(const sf::FloatRect& area, std::vector<GameObjectHandle>& results) const override;
+        void queryRadius(const sf::Vector2f& centre, float radius, std::vector<GameObjectHandle>& results) const override;
+        void queryNearest(const sf::Vector2f& point, std::size_t count, std::vector<GameObjectHandle>& results) const override;
+    };
+
+} // namespace KryptosEngine
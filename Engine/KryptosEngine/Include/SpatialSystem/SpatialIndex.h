@@ -0,0 +1,91 @@
+/*
+ * SpatialIndex.h - Kryptos Spatial Index Interface
+ * ------------------------------------------------
+ * Defines the interface shared by the engine's spatial indices, which answer
+ * "which objects are near here" without scanning every game object.
+ * The GameObjectManager keeps the active index in sync with object positions.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - GameObjectHandle.h: Objects are stored and returned by handle.
+ *   - SFML/Graphics.hpp: For vector and rectangle types.
+ *   - vector: For query results.
+ */
+
+#pragma once
+
+#include "../GameObjectSystem/GameObjectHandle.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstddef>
+
+namespace KryptosEngine {
+
+    /**
+     * @class SpatialIndex
+     * @brief Abstract index of game object positions.
+     *
+     * Objects are keyed by handle and stored as points. Queries append matching handles
+     * to a caller-owned vector, so repeated queries can reuse its capacity.
+     */
+    class SpatialIndex {
+    public:
+        /**
+         * @brief Virtual destructor for polymorphic deletion.
+         */
+        virtual ~SpatialIndex() = default;
+
+        /**
+         * @brief Adds an object to the index.
+         * @param handle The object's handle.
+         * @param position The object's position.
+         */
+        virtual void insert(GameObjectHandle handle, const sf::Vector2f& position) = 0;
+
+        /**
+         * @brief Moves an object that is already in the index.
+         *
+         * Only objects that leave their current cell or node are relinked.
+         * @param handle The object's handle.
+         * @param position The object's new position.
+         */
+        virtual void update(GameObjectHandle handle, const sf::Vector2f& position) = 0;
+
+        /**
+         * @brief Removes an object from the index.
+         * @param handle The object's handle.
+         */
+        virtual void remove(GameObjectHandle handle) = 0;
+
+        /**
+         * @brief Removes every object from the index.
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief Finds every object inside an axis-aligned box.
+         * @param area The box to search, in world coordinates.
+         * @param results Receives the handles of the objects found.
+         */
+        virtual void queryAABB(const sf::FloatRect& area, std::vector<GameObjectHandle>& results) const = 0;
+
+        /**
+         * @brief Finds every object within a distance of a point.
+         * @param centre The centre of the search circle.
+         * @param radius The search radius.
+         * @param results Receives the handles of the objects found.
+         */
+        virtual void queryRadius(const sf::Vector2f& centre, float radius, std::vector<GameObjectHandle>& results) const = 0;
+
+        /**
+         * @brief Finds the objects closest to a point.
+         * @param point The point to search from.
+         * @param count The maximum number of objects to return.
+         * @param results Receives the handles found, closest first.
+         */
+        virtual void queryNearest(const sf::Vector2f& point, std::size_t count, std::vector<GameObjectHandle>& results) const = 0;
+    };
+
+} // namespace KryptosEngine
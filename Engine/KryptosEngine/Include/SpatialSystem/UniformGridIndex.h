@@ -0,0 +1,111 @@
+/*
+ * UniformGridIndex.h - Kryptos Uniform Hash Grid
+ * ----------------------------------------------
+ * Spatial index that buckets objects into square cells of a fixed size.
+ * Only occupied cells are stored, in a hash map keyed by cell coordinates,
+ * so the world has no fixed bounds.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SpatialIndex.h: Base interface for spatial indices.
+ *   - unordered_map: For mapping cell coordinates to cells.
+ */
+
+#pragma once
+
+#include "SpatialIndex.h"
+#include <unordered_map>
+#include <cstdint>
+
+namespace KryptosEngine {
+
+    /**
+     * @class UniformGridIndex
+     * @brief Hash grid over game object positions.
+     *
+     * Best suited to objects spread fairly evenly at a density where most cells hold a handful
+     * of objects. Pick a cell size close to the typical query radius.
+     */
+    class UniformGridIndex : public SpatialIndex {
+    private:
+        /**
+         * @brief Per-slot record of an indexed object.
+         */
+        struct Entry {
+            sf::Vector2f position;     ///< Last known position of the object.
+            std::uint32_t generation;  ///< Generation of the handle that was inserted.
+            std::uint32_t cell;        ///< Index of the cell holding the object, or InvalidIndex if absent.
+            std::uint32_t cellIndex;   ///< Position of the object within its cell.
+        };
+
+        /**
+         * @brief An occupied grid cell.
+         */
+        struct Cell {
+            std::int32_t x;                    ///< Cell column.
+            std::int32_t y;                    ///< Cell row.
+            std::vector<std::uint32_t> slots;  ///< Slot indices of the objects in the cell.
+        };
+
+        float cellSize;                                      ///< Side length of a cell, in world units.
+        float inverseCellSize;                               ///< Reciprocal of the cell size.
+        std::vector<Entry> entries;                          ///< Object records, indexed by handle slot.
+        std::vector<Cell> cells;                             ///< Cell storage; empty cells are recycled.
+        std::vector<std::uint32_t> freeCells;                ///< Indices of recycled cells.
+        std::unordered_map<std::uint64_t, std::uint32_t> cellLookup; ///< Cell index by packed coordinates.
+        std::size_t objectCount;                             ///< Number of indexed objects.
+        std::int32_t minCellX, minCellY, maxCellX, maxCellY; ///< Bounds of every cell ever occupied.
+
+        /**
+         * @brief Packs cell coordinates into a hash key.
+         */
+        static std::uint64_t cellKey(std::int32_t x, std::int32_t y);
+
+        /**
+         * @brief Gets the cell coordinate of a world coordinate.
+         */
+        std::int32_t toCell(float value) const;
+
+        /**
+         * @brief Finds or creates the cell at the given coordinates.
+         * @return Index of the cell.
+         */
+        std::uint32_t acquireCell(std::int32_t x, std::int32_t y);
+
+        /**
+         * @brief Links an object into the cell containing its position.
+         * @param slot The object's slot index.
+         */
+        void link(std::uint32_t slot);
+
+        /**
+         * @brief Unlinks an object from its cell, recycling the cell if it becomes empty.
+         * @param slot The object's slot index.
+         */
+        void unlink(std::uint32_t slot);
+
+        /**
+         * @brief Finds a cell by coordinates without creating it.
+         * @return Pointer to the cell, or nullptr if it is not occupied.
+         */
+        const Cell* findCell(std::int32_t x, std::int32_t y) const;
+
+    public:
+        /**
+         * @brief Constructs an empty grid.
+         * @param cellSize Side length of a cell, in world units. Must be positive.
+         */
+        explicit UniformGridIndex(float cellSize);
+
+        void insert(GameObjectHandle handle, const sf::Vector2f& position) override;
+        void update(GameObjectHandle handle, const sf::Vector2f& position) override;
+        void remove(GameObjectHandle handle) override;
+        void clear() override;
+        void queryAABB(const sf::FloatRect& area, std::vector<GameObjectHandle>& results) const override;
+        void queryRadius(const sf::Vector2f& centre, float radius, std::vector<GameObjectHandle>& results) const override;
+        void queryNearest(const sf::Vector2f& point, std::size_t count, std::vector<GameObjectHandle>& results) const override;
+    };
+
+} // namespace KryptosEngine
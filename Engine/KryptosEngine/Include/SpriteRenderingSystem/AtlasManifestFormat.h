@@ -0,0 +1,92 @@
+/*
+ * AtlasManifestFormat.h - Kryptos Baked Atlas Manifest Layout
+ * -----------------------------------------------------------
+ * Defines the on-disk layout of a baked atlas manifest, written by the
+ * KryptosTools atlas baker and read by the TextureAtlas. A manifest is a
+ * header followed by a page table, a sprite table sorted by name and the
+ * string bytes both tables refer to.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - cstdint, type_traits: For fixed-width field types and layout checks.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace KryptosEngine {
+
+    /**
+     * @struct AtlasManifestHeader
+     * @brief First bytes of a baked atlas manifest.
+     *
+     * Offsets are in bytes from the start of the file. Strings are stored in `stringData` without
+     * terminators and referenced by offset and length. Page file names are relative to the
+     * manifest's directory.
+     */
+    struct AtlasManifestHeader {
+        char magic[8];              ///< Always AtlasManifestMagic.
+        std::uint32_t version;      ///< Format version, AtlasManifestVersion when written.
+        std::uint32_t byteOrder;    ///< AtlasManifestByteOrder as written by the baking machine.
+        std::uint64_t fileSize;     ///< Total size of the file, in bytes.
+        std::uint64_t inputHash;    ///< Hash of every input's name and content and of the bake settings.
+        std::uint32_t pageCount;    ///< Number of pages.
+        std::uint32_t spriteCount;  ///< Number of sprites.
+        std::uint64_t pages;        ///< AtlasManifestPage[pageCount].
+        std::uint64_t sprites;      ///< AtlasManifestSprite[spriteCount], sorted by name bytes.
+        std::uint64_t stringData;   ///< char[]: file and sprite names.
+    };
+
+    /**
+     * @struct AtlasManifestPage
+     * @brief An atlas page image.
+     */
+    struct AtlasManifestPage {
+        std::uint32_t fileName;       ///< Offset of the page's file name in stringData.
+        std::uint32_t fileNameLength; ///< Length of the file name, in bytes.
+        std::uint32_t width;          ///< Width of the page, in pixels.
+        std::uint32_t height;         ///< Height of the page, in pixels.
+        std::uint64_t contentHash;    ///< Hash of the sprites placed on the page and their rectangles.
+    };
+
+    /**
+     * @struct AtlasManifestSprite
+     * @brief A sprite's place on a page.
+     */
+    struct AtlasManifestSprite {
+        std::uint32_t name;         ///< Offset of the sprite's name in stringData.
+        std::uint32_t nameLength;   ///< Length of the name, in bytes.
+        std::uint32_t page;         ///< Index of the page holding the sprite.
+        std::uint32_t x;            ///< Left edge on the page, in pixels.
+        std::uint32_t y;            ///< Top edge on the page, in pixels.
+        std::uint32_t width;        ///< Width, in pixels.
+        std::uint32_t height;       ///< Height, in pixels.
+        std::uint32_t reserved;     ///< Zero; keeps sourceHash aligned.
+        std::uint64_t sourceHash;   ///< Hash of the source image file's bytes.
+    };
+
+    static_assert(std::is_trivially_copyable_v<AtlasManifestHeader>, "AtlasManifestHeader is written with a single copy");
+    static_assert(sizeof(AtlasManifestHeader) == 64, "AtlasManifestHeader layout must not depend on padding");
+    static_assert(sizeof(AtlasManifestPage) == 24, "AtlasManifestPage layout must not depend on padding");
+    static_assert(sizeof(AtlasManifestSprite) == 40, "AtlasManifestSprite layout must not depend on padding");
+
+    /**
+     * @brief Identifies a baked atlas manifest.
+     */
+    constexpr char AtlasManifestMagic[8] = { 'K', 'R', 'Y', 'P', 'A', 'T', 'L', 'S' };
+
+    /**
+     * @brief Current format version. Bump it whenever the layout or the packing changes.
+     */
+    constexpr std::uint32_t AtlasManifestVersion = 1;
+
+    /**
+     * @brief Written in native byte order; reads back differently on a machine of the other order.
+     */
+    constexpr std::uint32_t AtlasManifestByteOrder = 0x01020304u;
+
+} // namespace KryptosEngine
@@ -0,0 +1,107 @@
+/*
+ * SkylinePacker.h - Kryptos Rectangle Packer
+ * ------------------------------------------
+ * Defines the SkylinePacker class, which places rectangles on a fixed-size
+ * page for texture atlases. Has no graphics dependencies, so offline tools
+ * can pack the same way the engine does at runtime.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - vector: For the skyline segments.
+ *   - cstdint: For page coordinates.
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+ /**
+  * @class SkylinePacker
+  * @brief Bottom-left skyline packer for one atlas page.
+  *
+  * The page's used area is tracked as a skyline: left-to-right segments, each with the height
+  * below which the page is taken. A rectangle goes where its top edge ends lowest, ties broken
+  * by the narrower segment, which keeps the skyline flat. Space below the skyline that a
+  * placement leaves uncovered is not reused, which keeps insertion cheap at a small cost in
+  * density.
+  */
+class SkylinePacker {
+private:
+    /**
+     * @brief A run of the skyline at a single height.
+     */
+    struct Segment {
+        std::uint32_t x;      ///< Left edge.
+        std::uint32_t y;      ///< Height of the used area below the segment.
+        std::uint32_t width;  ///< Width of the segment.
+    };
+
+    std::uint32_t width;            ///< Width of the page.
+    std::uint32_t height;           ///< Height of the page.
+    std::vector<Segment> skyline;   ///< Segments, left to right, covering the page width.
+    std::uint64_t usedArea = 0;     ///< Total area of the placed rectangles.
+
+    /**
+     * @brief Finds the height a rectangle would sit at if its left edge were at a segment.
+     * @param segment Index of the segment.
+     * @param rectWidth Width of the rectangle.
+     * @param rectHeight Height of the rectangle.
+     * @param y Receives the height the rectangle would sit at.
+     * @return True if the rectangle fits there.
+     */
+    bool fitsAt(std::size_t segment, std::uint32_t rectWidth, std::uint32_t rectHeight, std::uint32_t& y) const;
+
+public:
+    /**
+     * @brief Position of a placed rectangle.
+     */
+    struct Placement {
+        std::uint32_t x; ///< Left edge.
+        std::uint32_t y; ///< Top edge.
+    };
+
+    /**
+     * @brief Constructs an empty page.
+     * @param width Width of the page.
+     * @param height Height of the page.
+     */
+    SkylinePacker(std::uint32_t width, std::uint32_t height);
+
+    /**
+     * @brief Places a rectangle on the page.
+     * @param rectWidth Width of the rectangle.
+     * @param rectHeight Height of the rectangle.
+     * @param placement Receives the rectangle's position.
+     * @return False if the rectangle does not fit; the page is then unchanged.
+     */
+    bool insert(std::uint32_t rectWidth, std::uint32_t rectHeight, Placement& placement);
+
+    /**
+     * @brief Empties the page.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the width of the page.
+     */
+    std::uint32_t getWidth() const {
+        return width;
+    }
+
+    /**
+     * @brief Gets the height of the page.
+     */
+    std::uint32_t getHeight() const {
+        return height;
+    }
+
+    /**
+     * @brief Gets the fraction of the page covered by placed rectangles.
+     * @return A value from 0 to 1.
+     */
+    float getOccupancy() const {
+        return static_cast<float>(static_cast<double>(usedArea) / (static_cast<double>(width) * height));
+    }
+};
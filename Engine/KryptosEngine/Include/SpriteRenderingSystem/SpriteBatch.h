@@ -0,0 +1,107 @@
+/*
+ * SpriteBatch.h - Kryptos Batched Sprite Rendering
+ * ------------------------------------------------
+ * Defines the SpriteBatch class, which collects the sprites drawn in a
+ * frame, groups them by texture and submits one draw call per texture.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SFML/Graphics.hpp: For vertex arrays, textures and render targets.
+ *   - SpriteRenderer.h: The sprites being batched.
+ *   - unordered_map, vector: For the per-texture batches.
+ */
+
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+#include "SpriteRenderer.h"
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+ /**
+  * @class SpriteBatch
+  * @brief Draws many sprites with one draw call per texture.
+  *
+  * Between begin and draw, every added sprite that overlaps the target's view is written
+  * as two triangles into the vertex array of its texture. draw then submits each non-empty
+  * array once. The arrays are kept from frame to frame and only cleared, so a steady number
+  * of sprites stops allocating after the first frames. Sprites sharing a texture are drawn
+  * in the order they were added; the order between textures is the order each texture was
+  * first seen.
+  */
+class SpriteBatch {
+private:
+    /**
+     * @brief Vertices of every sprite using one texture.
+     */
+    struct TextureBatch {
+        const sf::Texture* texture;  ///< Texture shared by the sprites.
+        sf::VertexArray vertices;    ///< Two triangles per sprite.
+    };
+
+    std::vector<TextureBatch> batches;                                  ///< Batches, in first-use order.
+    std::unordered_map<const sf::Texture*, std::uint32_t> batchByTexture; ///< Index of each texture's batch.
+    sf::FloatRect visibleArea;                                          ///< World area shown by the target's view.
+    std::size_t spriteCount = 0;                                        ///< Sprites added since begin.
+    std::size_t culledCount = 0;                                        ///< Sprites skipped since begin for being off screen.
+    std::size_t drawCallCount = 0;                                      ///< Draw calls issued by the last draw.
+
+public:
+    /**
+     * @brief Starts a frame, discarding the sprites of the previous one.
+     *
+     * Sprites are culled against the area shown by the target's current view.
+     * @param target The target the batch will be drawn to.
+     */
+    void begin(const sf::RenderTarget& target);
+
+    /**
+     * @brief Adds a sprite to the frame, unless it lies outside the visible area.
+     * @param renderer The sprite; renderers without a texture are ignored.
+     */
+    void add(const SpriteRenderer& renderer);
+
+    /**
+     * @brief Adds the sprite of every active game object holding a SpriteRenderer.
+     *
+     * Objects are found by their type's Components tuple, so a type holding a SpriteRenderer
+     * must be registered with GameObjectManager::registerType or created with spawn; objects
+     * left in the generic bucket are not drawn. Each sprite first swaps in a texture that
+     * finished loading in the background, and is moved to its object's position if it is not
+     * already there.
+     */
+    void addObjects();
+
+    /**
+     * @brief Draws every sprite added since begin, one draw call per texture.
+     * @param target The target to draw to.
+     */
+    void draw(sf::RenderTarget& target);
+
+    /**
+     * @brief Gets the number of sprites drawn by the current frame.
+     */
+    std::size_t getSpriteCount() const {
+        return spriteCount;
+    }
+
+    /**
+     * @brief Gets the number of sprites skipped by the current frame for being off screen.
+     */
+    std::size_t getCulledCount() const {
+        return culledCount;
+    }
+
+    /**
+     * @brief Gets the number of draw calls issued by the last draw.
+     */
+    std::size_t getDrawCallCount() const {
+        return drawCallCount;
+    }
+};
+
+#endif // SPRITEBATCH_H
@@ -9,32 +9,55 @@
  *
  * Dependencies:
  *   - SFML/Graphics.hpp: For sprite and texture handling.
+ *   - TextureAtlas.h: Packs loaded textures into shared atlas pages.
+ *   - TextureLoader.h: Loads textures in the background.
  *   - string: For texture path management.
- *   - unordered_map: For caching textures.
  *   - memory: For smart pointers.
+ *   - functional: For the texture changed callback.
  */
 
 #ifndef SPRITERENDERER_H
 #define SPRITERENDERER_H
 
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
 #include <SFML/Graphics.hpp>
 #include <string>
-#include <unordered_map>
 #include <memory>
+#include <functional>
 
  /**
   * @class SpriteRenderer
   * @brief Handles the rendering of 2D sprites and texture management.
   *
   * The SpriteRenderer class simplifies the process of loading, managing, and
-  * rendering sprites. It includes support for texture caching to optimize performance.
+  * rendering sprites. Textures are packed into the shared TextureAtlas, so the sprite
+  * shows a rectangle of an atlas page that many sprites can be batched with.
+  *
+  * Textures loaded with loadTextureAsync show the TextureLoader's placeholder until
+  * updatePendingTexture finds the load finished. The placeholder rarely has the size of the
+  * real texture, so an origin set with setRelativeOrigin follows the texture shown, and the
+  * texture changed callback lets the owner refit anything else sized from the sprite.
   */
 class SpriteRenderer {
 private:
     std::unique_ptr<sf::Sprite> sprite;             ///< Unique pointer to the sprite instance.
-    std::shared_ptr<sf::Texture> texture;           ///< Shared pointer to the sprite's texture.
-    static std::unordered_map<std::string,          ///< Cache for loaded textures.
-        std::shared_ptr<sf::Texture>> textureCache;
+    std::shared_ptr<sf::Texture> texture;           ///< Atlas page holding the sprite's texture.
+    std::shared_ptr<const TextureRequest> pendingTexture; ///< Load the placeholder is standing in for, if any.
+    sf::Vector2f relativeOrigin;                    ///< Origin as a fraction of the texture rectangle's size.
+    bool originIsRelative = false;                  ///< True if the origin follows the texture rectangle's size.
+    std::function<void()> textureChanged;           ///< Called when a loaded texture replaces the placeholder.
+
+    /**
+     * @brief Shows an atlas region, keeping the sprite's position, origin, rotation and scale.
+     * @param region The region to show.
+     */
+    void setRegion(const AtlasRegion& region);
+
+    /**
+     * @brief Recomputes a relative origin from the size of the texture rectangle shown.
+     */
+    void applyRelativeOrigin();
 
 public:
     /**
@@ -51,11 +74,46 @@ public:
     /**
      * @brief Loads a texture from a file and sets it for the sprite.
      *
-     * Caches the texture for efficient reuse. Throws an exception if the texture cannot be loaded.
+     * The texture is packed into the TextureAtlas on first use and shared afterwards.
+     * Throws an exception if the texture cannot be loaded.
      * @param texturePath The file path of the texture to load.
      */
     void loadTexture(const std::string& texturePath);
 
+    /**
+     * @brief Starts loading a texture in the background and shows a placeholder until it is ready.
+     *
+     * Never blocks on file access and never throws for a missing file; a failed load keeps
+     * the placeholder and is logged. Call updatePendingTexture each frame to pick up the texture.
+     * @param texturePath The file path of the texture to load.
+     */
+    void loadTextureAsync(const std::string& texturePath);
+
+    /**
+     * @brief Swaps the placeholder for the texture being loaded once its load has finished.
+     *
+     * Calls the texture changed callback after the swap.
+     * @return True if the sprite's texture changed.
+     */
+    bool updatePendingTexture();
+
+    /**
+     * @brief Sets a function called whenever updatePendingTexture swaps the placeholder for the loaded texture.
+     *
+     * Called on the thread calling updatePendingTexture, normally the main thread.
+     * @param callback The function, or an empty function to clear it.
+     */
+    void setTextureChangedCallback(std::function<void()> callback) {
+        textureChanged = std::move(callback);
+    }
+
+    /**
+     * @brief Checks whether the sprite is showing a placeholder for a texture still loading.
+     */
+    bool isTextureLoading() const {
+        return pendingTexture != nullptr;
+    }
+
     /**
      * @brief Sets the position of the sprite in the game world.
      * @param position The new position of the sprite.
@@ -68,12 +126,27 @@ public:
      */
     sf::Vector2f getPosition() const;
 
+    /**
+     * @brief Gets the sprite's bounding box relative to its position.
+     *
+     * Includes the origin, scale and rotation, so adding an object's position gives the
+     * sprite's world-space bounds. Used as the default collider for sprite-based objects.
+     * @return The offset bounds, or an empty rectangle if no texture is loaded.
+     */
+    sf::FloatRect getOffsetBounds() const;
+
     /**
      * @brief Sets the origin of the sprite for transformations.
-     * @param origin The new origin of the sprite.
+     * @param origin The new origin of the sprite, in pixels.
      */
     void setOrigin(const sf::Vector2f& origin);
 
+    /**
+     * @brief Sets the origin as a fraction of the texture rectangle's size, kept when the texture changes.
+     * @param factor The origin, from (0, 0) for the top-left corner to (1, 1) for the bottom-right.
+     */
+    void setRelativeOrigin(const sf::Vector2f& factor);
+
     /**
      * @brief Sets the rotation of the sprite.
      * @param angle The rotation angle in degrees.
@@ -98,6 +171,14 @@ public:
      */
     sf::Vector2f getScale() const;
 
+    /**
+     * @brief Gets the sprite, for batched rendering.
+     * @return The sprite, or nullptr if no texture is loaded.
+     */
+    const sf::Sprite* getSprite() const {
+        return sprite.get();
+    }
+
     /**
      * @brief Renders the sprite to the specified render window.
      * @param window The render window where the sprite will be drawn.
@@ -105,9 +186,9 @@ public:
     void draw(sf::RenderWindow& window) const;
 
     /**
-     * @brief Clears the global texture cache.
+     * @brief Clears the global texture atlas.
      *
-     * This function removes all cached textures from memory.
+     * Atlas pages stay in memory while sprites still use them.
      */
     static void clearCache();
 };
@@ -0,0 +1,157 @@
+/*
+ * TextureAtlas.h - Kryptos Runtime Texture Atlas
+ * ----------------------------------------------
+ * Defines the TextureAtlas class, which packs the images loaded for sprites
+ * into a few large textures, so sprites with different images can share a
+ * texture and be drawn in one batch.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SFML/Graphics.hpp: For images and textures.
+ *   - SkylinePacker.h: Places images on atlas pages.
+ *   - unordered_map, memory, string: For the region cache and shared pages.
+ */
+
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include "SkylinePacker.h"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * @struct AtlasRegion
+  * @brief Part of an atlas page holding one image.
+  */
+struct AtlasRegion {
+    std::shared_ptr<sf::Texture> page; ///< Page holding the image.
+    sf::IntRect rect;                  ///< Pixel area of the image on the page.
+};
+
+ /**
+  * @class TextureAtlas
+  * @brief Singleton packing sprite images into shared atlas pages.
+  *
+  * Images are placed on square pages by a SkylinePacker, with a pixel of padding so smoothing
+  * never samples a neighbour. A page is allocated when no existing page has room; images too
+  * large for a page get a page of their own. Regions are cached by file path, so each file is
+  * decoded and uploaded once. Pages are shared with the sprites using them and outlive clear
+  * for as long as any sprite does.
+  *
+  * Atlases baked offline by KryptosTools are loaded whole with loadManifest, which registers
+  * each baked sprite under its name without decoding or packing the source images.
+  */
+class TextureAtlas {
+private:
+    /**
+     * @brief Gap left around each image, in pixels.
+     */
+    static constexpr unsigned Padding = 1;
+
+    /**
+     * @brief An atlas page and the packer tracking its free space.
+     */
+    struct Page {
+        std::shared_ptr<sf::Texture> texture; ///< The page.
+        SkylinePacker packer;                 ///< Free space on the page.
+    };
+
+    unsigned pageSize;                                    ///< Width and height of a shared page.
+    std::vector<Page> pages;                              ///< Shared pages, oldest first.
+    std::size_t dedicatedPageCount = 0;                   ///< Pages holding a single oversized image.
+    std::size_t bakedPageCount = 0;                       ///< Pages loaded from baked manifests.
+    std::unordered_map<std::string, AtlasRegion> regions; ///< Region of each loaded file.
+
+    /**
+     * @brief Private constructor for Singleton pattern.
+     * Pages are 2048 pixels square, or the largest texture size the GPU supports if smaller.
+     */
+    TextureAtlas();
+
+    /**
+     * @brief Creates a texture of a given size.
+     * @param size Size of the texture.
+     * @param clear Whether to make every pixel transparent; unneeded when the caller overwrites them all.
+     * @throw std::runtime_error if the texture cannot be created.
+     */
+    static std::shared_ptr<sf::Texture> createTexture(sf::Vector2u size, bool clear);
+
+public:
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /**
+     * @brief Gets the singleton instance of the TextureAtlas.
+     * @return Reference to the singleton instance.
+     */
+    static TextureAtlas& getInstance();
+
+    /**
+     * @brief Gets the region of an image file, loading and packing it on first use.
+     * @param path Path of the image file.
+     * @return The image's region.
+     * @throw std::runtime_error if the file cannot be loaded.
+     */
+    const AtlasRegion& load(const std::string& path);
+
+    /**
+     * @brief Packs an image already in memory and caches its region under a key.
+     *
+     * Does nothing but return the cached region if the key is already present.
+     * @param key Key to cache the region under, usually the image's path.
+     * @param image The image.
+     * @return The image's region.
+     * @throw std::runtime_error if a page cannot be created.
+     */
+    const AtlasRegion& insert(const std::string& key, const sf::Image& image);
+
+    /**
+     * @brief Loads an atlas baked by KryptosTools and caches its sprites' regions by sprite name.
+     *
+     * Page images are loaded from the manifest's directory. Sprites whose name is already cached
+     * keep their existing region.
+     * @param path Path of the .katlas manifest.
+     * @return The number of sprites in the manifest.
+     * @throw std::runtime_error if the manifest is invalid or a page cannot be loaded.
+     */
+    std::size_t loadManifest(const std::string& path);
+
+    /**
+     * @brief Finds the cached region of a key.
+     * @param key The key.
+     * @return The region, or nullptr if the key was never loaded.
+     */
+    const AtlasRegion* find(const std::string& key) const;
+
+    /**
+     * @brief Forgets every region and page. Sprites keep the pages they use alive.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the width and height of a shared page.
+     */
+    unsigned getPageSize() const {
+        return pageSize;
+    }
+
+    /**
+     * @brief Gets the number of pages, including dedicated pages for oversized images and baked pages.
+     */
+    std::size_t getPageCount() const {
+        return pages.size() + dedicatedPageCount + bakedPageCount;
+    }
+
+    /**
+     * @brief Gets the fraction of the shared pages covered by images.
+     * @return A value from 0 to 1, or 0 with no shared pages.
+     */
+    float getOccupancy() const;
+};
+
+#endif // TEXTUREATLAS_H
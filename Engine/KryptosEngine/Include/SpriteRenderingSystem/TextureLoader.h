@@ -0,0 +1,153 @@
+/*
+ * TextureLoader.h - Kryptos Asynchronous Texture Loader
+ * -----------------------------------------------------
+ * Defines the TextureLoader class, which decodes image files on worker
+ * threads and packs them into the TextureAtlas on the main thread within a
+ * per-frame time budget, so loading large images never stalls a frame.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SFML/Graphics.hpp: For decoding images and timing uploads.
+ *   - TextureAtlas.h: Receives the decoded images.
+ *   - MpscQueue.h: Hands decoded images back to the main thread.
+ *   - thread, mutex, condition_variable: For the decode workers.
+ *   - unordered_map, deque, memory, string: For tracking requests.
+ */
+
+#ifndef TEXTURELOADER_H
+#define TEXTURELOADER_H
+
+#include "TextureAtlas.h"
+#include "../GameObjectSystem/MpscQueue.h"
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * @brief Progress of an asynchronous texture load.
+  */
+enum class TextureLoadState {
+    Decoding,   ///< Queued for or being decoded on a worker.
+    Uploading,  ///< Decoded, waiting for its upload on the main thread.
+    Ready,      ///< Packed into the atlas; the region is valid.
+    Failed      ///< The file could not be decoded.
+};
+
+ /**
+  * @struct TextureRequest
+  * @brief An asynchronous texture load, shared by everyone who requested the same path.
+  *
+  * The state and region are written and read on the main thread only; workers touch just
+  * the decoded image before handing the request back.
+  */
+struct TextureRequest {
+    std::string path;                                  ///< File being loaded.
+    TextureLoadState state = TextureLoadState::Decoding; ///< Progress of the load.
+    AtlasRegion region;                                ///< Region in the atlas, once Ready.
+    sf::Image image;                                   ///< Decoded image, until uploaded.
+    bool decoded = false;                              ///< Set by the worker if decoding succeeded.
+    TextureRequest* next = nullptr;                    ///< Link in the decoded queue.
+};
+
+ /**
+  * @class TextureLoader
+  * @brief Singleton loading textures in the background.
+  *
+  * request returns at once. A worker decodes the file into an sf::Image and queues it for
+  * processUploads, which the main thread calls once per frame to pack decoded images into the
+  * TextureAtlas until the frame's budget is spent. Requests for a path that is already being
+  * loaded share the one in flight, and paths already in the atlas complete immediately.
+  *
+  * Sprites show getPlaceholder until their request is Ready.
+  */
+class TextureLoader {
+private:
+    /**
+     * @brief Atlas key of the placeholder image.
+     */
+    static constexpr const char* PlaceholderKey = "<placeholder>";
+
+    std::vector<std::thread> workers;                                         ///< Decode threads.
+    std::mutex decodeMutex;                                                   ///< Guards decodeQueue and running.
+    std::condition_variable decodeCondition;                                  ///< Signalled when requests are queued or on shutdown.
+    std::deque<std::shared_ptr<TextureRequest>> decodeQueue;                  ///< Requests waiting for a worker.
+    bool running = true;                                                      ///< Cleared to stop the workers.
+    MpscQueue<TextureRequest> decodedQueue;                                   ///< Requests handed back by the workers.
+    std::deque<TextureRequest*> uploadQueue;                                  ///< Decoded requests waiting for an upload, oldest first.
+    std::unordered_map<std::string, std::shared_ptr<TextureRequest>> inFlight; ///< Unfinished requests by path.
+    std::size_t lastUploadCount = 0;                                          ///< Uploads done by the last processUploads.
+
+    /**
+     * @brief Private constructor for Singleton pattern. Starts the decode workers.
+     */
+    TextureLoader();
+
+    /**
+     * @brief Stops and joins the decode workers.
+     *
+     * A decode already in progress finishes first; requests still waiting to be decoded or
+     * uploaded are abandoned and never become Ready.
+     */
+    ~TextureLoader();
+
+    /**
+     * @brief Decodes queued requests until shutdown.
+     */
+    void workerLoop();
+
+public:
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    /**
+     * @brief Gets the singleton instance of the TextureLoader.
+     * @return Reference to the singleton instance.
+     */
+    static TextureLoader& getInstance();
+
+    /**
+     * @brief Starts loading an image file, or joins the load already in flight. Main thread only.
+     * @param path Path of the image file.
+     * @return The request, which is already Ready if the path is in the atlas.
+     */
+    std::shared_ptr<const TextureRequest> request(const std::string& path);
+
+    /**
+     * @brief Packs decoded images into the atlas until a time budget is spent. Main thread only.
+     *
+     * At least one image is uploaded per call when any is waiting, so loading always advances.
+     * @param budget Time the uploads may take this frame.
+     * @return The number of requests completed, failures included.
+     */
+    std::size_t processUploads(sf::Time budget);
+
+    /**
+     * @brief Gets the region of the placeholder drawn while a texture loads, creating it on first use.
+     * @return The placeholder's region.
+     */
+    const AtlasRegion& getPlaceholder();
+
+    /**
+     * @brief Gets the number of requests still decoding or waiting for an upload.
+     */
+    std::size_t getPendingCount() const {
+        return inFlight.size();
+    }
+
+    /**
+     * @brief Gets the number of requests completed by the last processUploads.
+     */
+    std::size_t getLastUploadCount() const {
+        return lastUploadCount;
+    }
+};
+
+#endif // TEXTURELOADER_H
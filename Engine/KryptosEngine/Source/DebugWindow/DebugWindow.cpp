@@ -13,9 +13,17 @@
  *   - Text.hpp, Font.hpp: SFML text and font handling.
  *   - DebugWindow.h: Header for DebugWindow class.
  *   - stdexcept: For exception handling.
+ *   - PhysicsSystem.h: For physics throughput statistics.
+ *   - EventBus.h: For per-type event queue statistics.
+ *   - TextureAtlas.h: For atlas page statistics.
+ *   - TextureLoader.h: For background texture load statistics.
  */
 
 #include "../Include/DebugWindow/DebugWindow.h"
+#include "../Include/PhysicsSystem/PhysicsSystem.h"
+#include "../Include/EventSystem/EventBus.h"
+#include "../Include/SpriteRenderingSystem/TextureAtlas.h"
+#include "../Include/SpriteRenderingSystem/TextureLoader.h"
 
 namespace KryptosEngine {
     namespace DebugWindow {
@@ -107,12 +115,93 @@ namespace KryptosEngine {
 
             float yOffset = 10.f;
 
-            for (const auto& object : GameObjectManager::getInstance().getGameObjects()) {
-                if (!object->isActive()) continue;
+            // Render physics statistics
+            const PhysicsSystem& physics = PhysicsSystem::getInstance();
+            sf::Text physicsText(defaultFont,
+                sf::String("Physics (" + std::string(PhysicsSystem::getSimdInstructionSet()) + "): " +
+                    std::to_string(physics.getLastBodyCount()) + " bodies, " +
+                    std::to_string(static_cast<int>(physics.getBodiesPerMillisecond())) + " bodies/ms, " +
+                    std::to_string(physics.getBroadphase().getPairCount()) + " overlaps"),
+                14);
+            physicsText.setFillColor(sf::Color::Yellow);
+            physicsText.setPosition(sf::Vector2f(10.f, yOffset));
+            debugWindow.draw(physicsText);
+            yOffset += 20.f;
 
+            // Render update statistics
+            GameObjectManager& manager = GameObjectManager::getInstance();
+            sf::Text updateText(defaultFont,
+                sf::String("Updates: " + std::to_string(manager.getLastTickedCount()) + " of " +
+                    std::to_string(manager.getActiveObjects().size()) + " active objects ticked"),
+                14);
+            updateText.setFillColor(sf::Color::Yellow);
+            updateText.setPosition(sf::Vector2f(10.f, yOffset));
+            debugWindow.draw(updateText);
+            yOffset += 20.f;
+
+            // Render object pool statistics
+            for (const auto& pool : GameObjectManager::getInstance().getPools()) {
+                sf::Text poolText(defaultFont,
+                    sf::String("Pool " + pool->getTypeName() + ": " +
+                        std::to_string(pool->getLiveCount()) + " live, " +
+                        std::to_string(pool->getHighWaterMark()) + " high-water, " +
+                        std::to_string(pool->getCapacity()) + " capacity"),
+                    14);
+                poolText.setFillColor(sf::Color::Yellow);
+                poolText.setPosition(sf::Vector2f(10.f, yOffset));
+                debugWindow.draw(poolText);
+                yOffset += 20.f;
+            }
+
+            // Render texture atlas statistics
+            const TextureAtlas& atlas = TextureAtlas::getInstance();
+            sf::Text atlasText(defaultFont,
+                sf::String("Texture atlas: " + std::to_string(atlas.getPageCount()) + " pages of " +
+                    std::to_string(atlas.getPageSize()) + "px, " +
+                    std::to_string(static_cast<int>(atlas.getOccupancy() * 100.f)) + "% used"),
+                14);
+            atlasText.setFillColor(sf::Color::Yellow);
+            atlasText.setPosition(sf::Vector2f(10.f, yOffset));
+            debugWindow.draw(atlasText);
+            yOffset += 20.f;
+
+            // Render background texture load statistics
+            const TextureLoader& loader = TextureLoader::getInstance();
+            sf::Text loaderText(defaultFont,
+                sf::String("Texture loads: " + std::to_string(loader.getPendingCount()) + " pending, " +
+                    std::to_string(loader.getLastUploadCount()) + " uploaded last frame"),
+                14);
+            loaderText.setFillColor(sf::Color::Yellow);
+            loaderText.setPosition(sf::Vector2f(10.f, yOffset));
+            debugWindow.draw(loaderText);
+            yOffset += 20.f;
+
+            // Render event queue statistics
+            for (const auto& queue : EventBus::getInstance().getQueues()) {
+                sf::Text eventText(defaultFont,
+                    sf::String("Events " + queue->getTypeName() + ": " +
+                        std::to_string(queue->getLastBatchSize()) + " last batch, " +
+                        std::to_string(queue->getHighWaterMark()) + " high-water, " +
+                        std::to_string(queue->getCapacity()) + " capacity, " +
+                        std::to_string(queue->getDroppedCount()) + " dropped"),
+                    14);
+                eventText.setFillColor(sf::Color::Yellow);
+                eventText.setPosition(sf::Vector2f(10.f, yOffset));
+                debugWindow.draw(eventText);
+                yOffset += 20.f;
+            }
+            yOffset += 10.f;
+
+            for (GameObject* object : GameObjectManager::getInstance().getActiveObjects()) {
                 // Render game object name
-                sf::String displayName = sf::String("Name: ") + object->getName();
-                sf::Text nameText(defaultFont, displayName, 14);
+                const NameId nameId = object->getNameId();
+                if (nameId >= nameLabels.size()) {
+                    nameLabels.resize(nameId + 1);
+                }
+                if (nameLabels[nameId].isEmpty()) {
+                    nameLabels[nameId] = sf::String("Name: " + std::string(object->getName()));
+                }
+                sf::Text nameText(defaultFont, nameLabels[nameId], 14);
                 nameText.setFillColor(sf::Color::White);
                 nameText.setPosition(sf::Vector2f(10.f, yOffset));
                 debugWindow.draw(nameText);
@@ -126,46 +215,68 @@ namespace KryptosEngine {
 
                 // Render additional details if expanded
                 if (expandedState[object]) {
-                    sf::Text positionText(defaultFont,
-                        sf::String("Position: (" +
+                    // Rebuild the labels only if the object changed since they were built
+                    DetailLabels& labels = detailLabels[object];
+                    const std::uint32_t version = GameObjectManager::getInstance().getChangeVersion(object->getHandle());
+                    if (labels.handle != object->getHandle() || labels.version != version) {
+                        labels.handle = object->getHandle();
+                        labels.version = version;
+                        labels.position = sf::String("Position: (" +
                             std::to_string(object->getPosition().x) + ", " +
-                            std::to_string(object->getPosition().y) + ")"),
-                        14);
+                            std::to_string(object->getPosition().y) + ")");
+                        labels.rotation = sf::String("Rotation: " + std::to_string(object->getRotation().asDegrees()) + " degrees");
+                        labels.mass = sf::String("Mass: " + std::to_string(object->getMass()));
+                        labels.gravity = sf::String("Use Gravity: " + std::string(object->getUseGravity() ? "true" : "false"));
+                    }
+
+                    sf::Text positionText(defaultFont, labels.position, 14);
                     positionText.setFillColor(sf::Color::White);
                     positionText.setPosition(sf::Vector2f(20.f, yOffset));
                     debugWindow.draw(positionText);
                     yOffset += 20.f;
 
-                    sf::Text rotationText(defaultFont,
-                        sf::String("Rotation: " + std::to_string(object->getRotation().asDegrees()) + " degrees"),
-                        14);
+                    sf::Text rotationText(defaultFont, labels.rotation, 14);
                     rotationText.setFillColor(sf::Color::White);
                     rotationText.setPosition(sf::Vector2f(20.f, yOffset));
                     debugWindow.draw(rotationText);
                     yOffset += 20.f;
 
-                    sf::Text massText(defaultFont,
-                        sf::String("Mass: " + std::to_string(object->getMass())),
-                        14);
+                    sf::Text massText(defaultFont, labels.mass, 14);
                     massText.setFillColor(sf::Color::White);
                     massText.setPosition(sf::Vector2f(20.f, yOffset));
                     debugWindow.draw(massText);
                     yOffset += 20.f;
 
-                    sf::Text gravityText(defaultFont,
-                        sf::String("Use Gravity: " + std::string(object->getUseGravity() ? "true" : "false")),
-                        14);
+                    sf::Text gravityText(defaultFont, labels.gravity, 14);
                     gravityText.setFillColor(sf::Color::White);
                     gravityText.setPosition(sf::Vector2f(20.f, yOffset));
                     debugWindow.draw(gravityText);
                     yOffset += 20.f;
 
-                    const auto& trackedVars = object->getDebugTrackedValues();
-                    for (const auto& [name, getter] : trackedVars) {
-                        sf::Text trackedVarText(defaultFont, name + ": " + getter(), 14);
-                        trackedVarText.setFillColor(sf::Color::White);
-                        trackedVarText.setPosition(sf::Vector2f(20.f, yOffset));
-                        debugWindow.draw(trackedVarText);
+                    // Format the debug probes into a stack buffer and restring only the values that changed
+                    const std::vector<DebugProbe>& probes = object->getDebugProbes();
+                    if (labels.probeTexts.size() != probes.size()) {
+                        // Formatted values are never empty, so every probe is strung on first use
+                        sf::Text probeText(defaultFont, "", 14);
+                        probeText.setFillColor(sf::Color::White);
+                        labels.probeValues.assign(probes.size(), std::string());
+                        labels.probeTexts.assign(probes.size(), probeText);
+                    }
+
+                    for (std::size_t i = 0; i < probes.size(); ++i) {
+                        char value[64];
+                        const std::size_t length = object->formatDebugValue(probes[i], value, sizeof(value));
+                        const std::string_view valueText(value, length);
+                        sf::Text& probeText = labels.probeTexts[i];
+                        if (labels.probeValues[i] != valueText) {
+                            labels.probeValues[i].assign(valueText);
+                            probeLabel.assign(probes[i].name);
+                            probeLabel.append(": ");
+                            probeLabel.append(valueText);
+                            probeText.setString(sf::String(probeLabel));
+                        }
+                        probeText.setPosition(sf::Vector2f(20.f, yOffset));
+                        debugWindow.draw(probeText);
                         yOffset += 20.f;
                     }
                 }
@@ -0,0 +1,67 @@
+/*
+ * EventBus.cpp - Kryptos Typed Event Bus Implementation
+ * -----------------------------------------------------
+ * Implements the EventBus singleton and per-stage dispatch of its queues.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - EventBus.h: Header for the EventBus and EventQueue classes.
+ */
+
+#include "../Include/EventSystem/EventBus.h"
+
+namespace KryptosEngine {
+
+    /**
+     * @brief Constructs an empty queue.
+     *
+     * The capacity is rounded up to a power of two, so ring buffer positions are found by masking.
+     * @param typeName Display name of the event type.
+     * @param stage Stage at which the events are delivered.
+     * @param capacity Number of events the queue holds.
+     */
+    EventQueueBase::EventQueueBase(const std::string& typeName, EventStage stage, std::size_t capacity)
+        : typeName(typeName),
+        stage(stage),
+        capacity(1) {
+        while (this->capacity < capacity) {
+            this->capacity <<= 1;
+        }
+    }
+
+    /**
+     * @brief Gets the singleton instance of the EventBus.
+     * @return Reference to the singleton instance.
+     */
+    EventBus& EventBus::getInstance() {
+        static EventBus instance;
+        return instance;
+    }
+
+    /**
+     * @brief Delivers the queued events of every type belonging to a stage.
+     *
+     * Queues are visited in registration order. The queue list is indexed rather than
+     * iterated, so subscribers may register new event types while it is walked.
+     * @param stage The stage the game loop has reached.
+     */
+    void EventBus::dispatch(EventStage stage) {
+        for (std::size_t i = 0; i < queues.size(); ++i) {
+            if (queues[i]->getStage() == stage) {
+                queues[i]->dispatch();
+            }
+        }
+    }
+
+    /**
+     * @brief Discards every queued event of every type.
+     */
+    void EventBus::clear() {
+        for (const std::unique_ptr<EventQueueBase>& queue : queues) {
+            queue->clear();
+        }
+    }
+
+} // namespace KryptosEngine
@@ -0,0 +1,88 @@
+/*
+ * CommandBuffer.cpp - Kryptos Deferred Structural Commands Implementation
+ * -----------------------------------------------------------------------
+ * Implements payload storage and spawn execution for the CommandBuffer.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - CommandBuffer.h: Header for the CommandBuffer class.
+ */
+
+#include "../Include/GameObjectSystem/CommandBuffer.h"
+
+/**
+ * @brief Destroys any payloads that were never executed.
+ */
+CommandBuffer::~CommandBuffer() {
+    clear();
+}
+
+/**
+ * @brief Reserves aligned payload storage.
+ *
+ * Payloads are bump-allocated from the current block, moving on to the next block (or a
+ * new one) when the current one is full.
+ * @param size Size of the payload, in bytes.
+ * @param alignment Alignment of the payload.
+ * @return Pointer to the storage.
+ */
+void* CommandBuffer::allocate(std::size_t size, std::size_t alignment) {
+    if (size > BlockSize) {
+        oversized.push_back(std::make_unique<std::byte[]>(size));
+        return oversized.back().get();
+    }
+
+    std::size_t offset = (blockOffset + alignment - 1) / alignment * alignment;
+    if (currentBlock < blocks.size() && offset + size > BlockSize) {
+        ++currentBlock;
+        offset = 0;
+    }
+    if (currentBlock == blocks.size()) {
+        blocks.push_back(std::make_unique<std::byte[]>(BlockSize));
+        offset = 0;
+    }
+
+    blockOffset = offset + size;
+    return blocks[currentBlock].get() + offset;
+}
+
+/**
+ * @brief Runs one recorded spawn and destroys its callable.
+ *
+ * The callable is marked destroyed before it runs, and destroyed even if it throws, so
+ * clear never destroys it a second time.
+ * @param index Index of the spawn, in recording order.
+ */
+void CommandBuffer::executeSpawn(std::size_t index) {
+    SpawnCommand& command = spawns[index];
+    void (*destroy)(void*) = command.destroy;
+    command.destroy = nullptr;
+    try {
+        command.execute(command.payload);
+    }
+    catch (...) {
+        destroy(command.payload);
+        throw;
+    }
+    destroy(command.payload);
+}
+
+/**
+ * @brief Drops every command, destroying the callables of spawns that never ran.
+ */
+void CommandBuffer::clear() {
+    for (const SpawnCommand& command : spawns) {
+        if (command.destroy != nullptr) {
+            command.destroy(command.payload);
+        }
+    }
+    spawns.clear();
+    destroys.clear();
+    oversized.clear();
+    currentBlock = 0;
+    blockOffset = 0;
+    source = 0;
+    nextSequence = 0;
+}
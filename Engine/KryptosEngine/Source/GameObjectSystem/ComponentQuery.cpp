@@ -0,0 +1,31 @@
+/*
+ * ComponentQuery.cpp - Kryptos Component Layouts Implementation
+ * -------------------------------------------------------------
+ * Assigns component type IDs.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - ComponentQuery.h: Header for component layouts.
+ *   - atomic: IDs may be assigned from several threads.
+ *   - stdexcept: For reporting too many component types.
+ */
+
+#include "../Include/GameObjectSystem/ComponentQuery.h"
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * @brief Assigns the next component type ID.
+ * @return A new ID below MaxComponentTypes.
+ * @throw std::length_error if every ID is taken.
+ */
+std::uint32_t nextComponentTypeId() {
+    static std::atomic<std::uint32_t> next{ 0 };
+    const std::uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+    if (id >= MaxComponentTypes) {
+        throw std::length_error("Too many component types for a ComponentMask");
+    }
+    return id;
+}
@@ -0,0 +1,151 @@
+/*
+ * DebugProbe.cpp - Kryptos Debug Value Probes Implementation
+ * ----------------------------------------------------------
+ * Implements probe formatting and the shared per-type probe tables.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - DebugProbe.h: Header for DebugProbe and DebugProbeRegistry.
+ *   - cstdio: Formats values into caller-provided buffers.
+ *   - algorithm: Skips probes whose name a table already holds.
+ */
+
+#include "../Include/GameObjectSystem/DebugProbe.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    /**
+     * @brief Reads a value of type T at an address.
+     */
+    template <typename T>
+    T readValue(const char* address) {
+        T value;
+        std::memcpy(&value, address, sizeof(T));
+        return value;
+    }
+}
+
+/**
+ * @brief Formats the probed member of an object.
+ *
+ * Uses the same text as std::to_string, without the heap string.
+ * @param object Address of the object's GameObject base.
+ * @param buffer Receives the text.
+ * @param size Size of the buffer.
+ * @return The length of the text, truncated to fit the buffer.
+ */
+std::size_t DebugProbe::format(const void* object, char* buffer, std::size_t size) const {
+    if (size == 0) {
+        return 0;
+    }
+
+    const char* address = static_cast<const char*>(object) + offset;
+    int length = 0;
+    switch (type) {
+    case DebugValueType::Bool:
+        length = std::snprintf(buffer, size, "%s", readValue<bool>(address) ? "true" : "false");
+        break;
+    case DebugValueType::Int32:
+        length = std::snprintf(buffer, size, "%" PRId32, readValue<std::int32_t>(address));
+        break;
+    case DebugValueType::UInt32:
+        length = std::snprintf(buffer, size, "%" PRIu32, readValue<std::uint32_t>(address));
+        break;
+    case DebugValueType::Int64:
+        length = std::snprintf(buffer, size, "%" PRId64, readValue<std::int64_t>(address));
+        break;
+    case DebugValueType::UInt64:
+        length = std::snprintf(buffer, size, "%" PRIu64, readValue<std::uint64_t>(address));
+        break;
+    case DebugValueType::Float:
+        length = std::snprintf(buffer, size, "%f", static_cast<double>(readValue<float>(address)));
+        break;
+    case DebugValueType::Double:
+        length = std::snprintf(buffer, size, "%f", readValue<double>(address));
+        break;
+    }
+
+    if (length < 0) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return std::min(static_cast<std::size_t>(length), size - 1);
+}
+
+/**
+ * @brief Gets the table of a type, if one was published.
+ *
+ * Tables never change once published, so a found table can be cached by each thread. Missing
+ * tables are not cached, since another thread may publish them at any time.
+ * @param objectType The type.
+ * @return The type's table, or nullptr if none was published yet.
+ */
+const DebugProbeTable* DebugProbeRegistry::find(std::type_index objectType) {
+    thread_local std::unordered_map<std::type_index, const DebugProbeTable*> cache;
+    const auto cached = cache.find(objectType);
+    if (cached != cache.end()) {
+        return cached->second;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = tableByType.find(objectType);
+    if (it == tableByType.end()) {
+        return nullptr;
+    }
+    cache.emplace(objectType, it->second);
+    return it->second;
+}
+
+/**
+ * @brief Publishes the tables of the types whose probes an object staged during construction.
+ *
+ * Each table is filled once, in one pass over its type's run of staged probes, so building a
+ * type with n probes copies its base entries once rather than once per probe.
+ * @param inherited The table the object had found before it staged its first probe, or nullptr.
+ * @param staged The staged probes, in registration order.
+ * @return The table of the last staged type, valid for the program's lifetime.
+ */
+const DebugProbeTable* DebugProbeRegistry::publish(const DebugProbeTable* inherited, const std::vector<StagedDebugProbe>& staged) {
+    if (staged.empty()) {
+        return inherited;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const DebugProbeTable* table = inherited;
+    std::size_t begin = 0;
+    while (begin < staged.size()) {
+        const std::type_index objectType = staged[begin].objectType;
+        std::size_t end = begin + 1;
+        while (end < staged.size() && staged[end].objectType == objectType) {
+            ++end;
+        }
+
+        const DebugProbeTable*& published = tableByType[objectType];
+        if (published == nullptr) {
+            DebugProbeTable& built = tables.emplace_back(DebugProbeTable{ objectType, {} });
+            if (table != nullptr) {
+                built.probes.reserve(table->probes.size() + (end - begin));
+                built.probes.insert(built.probes.end(), table->probes.begin(), table->probes.end());
+            }
+            for (std::size_t i = begin; i < end; ++i) {
+                const StagedDebugProbe& probe = staged[i];
+                if (std::any_of(built.probes.begin(), built.probes.end(), [&probe](const DebugProbe& existing) {
+                    return existing.name == probe.name;
+                    })) {
+                    continue;
+                }
+                const std::string_view name = *names.insert(probe.name).first;
+                built.probes.push_back({ name, static_cast<std::int32_t>(probe.offset), probe.valueType });
+            }
+            published = &built;
+        }
+        table = published;
+        begin = end;
+    }
+    return table;
+}
@@ -9,13 +9,22 @@
  * Dependencies:
  *   - GameObject.h: Header for the GameObject class.
  *   - GameObjectManager.h: Manages registration of game objects.
+ *   - DebugProbe.h: Shared debug probe tables (via GameObject.h).
  */
 
 #include "../Include/GameObjectSystem/GameObject.h"
 #include "../Include/GameObjectSystem/GameObjectManager.h"
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <typeindex>
 
  /**
   * @brief Constructs a GameObject and registers it with the GameObjectManager.
+  *
+  * The name is interned in the NameTable, and the initial properties are written into
+  * the manager's TransformStore. Off the main thread the name and properties are held,
+  * without touching either, until the object is published; see GameObjectManager::create.
   * @param name Name of the game object.
   * @param position Initial position of the object.
   * @param active Whether the object is active.
@@ -28,9 +37,8 @@ GameObject::GameObject(const std::string& name,
     const bool& active,
     const sf::Angle& rotation,
     const float& mass,
-    const bool& useGravity)
-    : name(name), position(position), active(true), rotation(rotation), mass(mass), useGravity(true) {
-    GameObjectManager::getInstance().registerObject(this);
+    const bool& useGravity) {
+    GameObjectManager::getInstance().registerObject(this, name, position, active, rotation.asRadians(), mass, useGravity);
 }
 
 /**
@@ -41,48 +49,160 @@ GameObject::~GameObject() {
     GameObjectManager::getInstance().unregisterObject(this);
 }
 
+/**
+ * @brief Updates the object's logic.
+ * The base implementation does nothing.
+ * @param deltaTime Time elapsed since the last frame.
+ */
+void GameObject::update(float deltaTime) {
+    (void)deltaTime;
+}
+
+/**
+ * @brief Called once the object is fully constructed and registered.
+ * The base implementation does nothing.
+ */
+void GameObject::onRegistered() {
+}
+
+/**
+ * @brief Gets this object's index into the TransformStore columns.
+ * @return The dense index of the object in the GameObjectManager.
+ */
+std::uint32_t GameObject::transformIndex() const {
+    return GameObjectManager::getInstance().getDenseIndex(handle);
+}
+
+/**
+ * @brief Adds a probe to this object's type, unless its type already has a probe table.
+ *
+ * typeid(*this) names the type whose constructor is running, so each constructor in a
+ * hierarchy registers into its own type's table, which starts from the base type's entries.
+ * @param name The display name of the variable.
+ * @param type The type of the variable.
+ * @param offset Byte offset of the variable from this object.
+ * @throw std::invalid_argument if the offset cannot belong to a member of this object.
+ */
+void GameObject::registerDebugProbe(std::string_view name, DebugValueType type, std::ptrdiff_t offset) {
+    if (offset < 0 || offset > std::numeric_limits<std::int32_t>::max()) {
+        throw std::invalid_argument("Debug variable '" + std::string(name) + "' is not a member of its game object.");
+    }
+    GameObjectManager::getInstance().addDebugProbe(this, std::type_index(typeid(*this)), name, type, offset);
+}
+
+/**
+ * @brief Retrieves the debug probes of this object's type.
+ * @return The probes, in registration order; empty if none were registered.
+ */
+const std::vector<DebugProbe>& GameObject::getDebugProbes() const {
+    static const std::vector<DebugProbe> noProbes;
+    const DebugProbeTable* table = GameObjectManager::getInstance().getObjectDebugProbes(handle);
+    return table != nullptr ? table->probes : noProbes;
+}
+
 // Getters
-std::string GameObject::getName() const {
-    return name;
+GameObjectHandle GameObject::getHandle() const {
+    return handle;
+}
+
+std::string_view GameObject::getName() const {
+    return NameTable::getInstance().view(getNameId());
+}
+
+NameId GameObject::getNameId() const {
+    return GameObjectManager::getInstance().getObjectNameId(handle);
 }
 
 sf::Vector2f GameObject::getPosition() const {
-    return position;
+    const TransformStore& transforms = GameObjectManager::getInstance().getTransforms();
+    const std::uint32_t index = transformIndex();
+    return sf::Vector2f(transforms.positionX[index], transforms.positionY[index]);
 }
 
 bool GameObject::isActive() const {
-    return active;
+    return GameObjectManager::getInstance().isObjectActive(handle);
 }
 
 float GameObject::getMass() const {
-    return mass;
+    return GameObjectManager::getInstance().getTransforms().mass[transformIndex()];
 }
 
 bool GameObject::getUseGravity() const {
-    return useGravity;
+    return GameObjectManager::getInstance().getTransforms().useGravity[transformIndex()] != 0;
 }
 
 sf::Angle GameObject::getRotation() const {
-    return rotation;
+    return sf::radians(GameObjectManager::getInstance().getTransforms().rotation[transformIndex()]);
+}
+
+sf::Vector2f GameObject::getVelocity() const {
+    const TransformStore& transforms = GameObjectManager::getInstance().getTransforms();
+    const std::uint32_t index = transformIndex();
+    return sf::Vector2f(transforms.velocityX[index], transforms.velocityY[index]);
+}
+
+std::uint8_t GameObject::getChangeFlags() const {
+    return GameObjectManager::getInstance().getChangeFlags(handle);
+}
+
+bool GameObject::hasChanged(std::uint8_t flags) const {
+    return (getChangeFlags() & flags) != 0;
 }
 
 // Setters
 void GameObject::setPosition(const sf::Vector2f& newPosition) {
-    position = newPosition;
+    GameObjectManager::getInstance().setObjectPosition(handle, newPosition);
 }
 
 void GameObject::setActive(bool state) {
-    active = state;
+    GameObjectManager::getInstance().setObjectActive(this, state);
 }
 
 void GameObject::setMass(float newMass) {
-    mass = newMass;
+    GameObjectManager& manager = GameObjectManager::getInstance();
+    float& mass = manager.getTransforms().mass[transformIndex()];
+    if (mass != newMass) {
+        mass = newMass;
+        manager.markChanged(handle, ChangeFlags::Physics);
+    }
 }
 
 void GameObject::setUseGravity(bool state) {
-    useGravity = state;
+    GameObjectManager& manager = GameObjectManager::getInstance();
+    std::uint8_t& useGravity = manager.getTransforms().useGravity[transformIndex()];
+    if ((useGravity != 0) != state) {
+        useGravity = state ? 1 : 0;
+        manager.markChanged(handle, ChangeFlags::Physics);
+    }
 }
 
 void GameObject::setRotation(const sf::Angle& newRotation) {
-    rotation = newRotation;
+    GameObjectManager& manager = GameObjectManager::getInstance();
+    float& rotation = manager.getTransforms().rotation[transformIndex()];
+    if (rotation != newRotation.asRadians()) {
+        rotation = newRotation.asRadians();
+        manager.markChanged(handle, ChangeFlags::Rotation);
+    }
+}
+
+void GameObject::setVelocity(const sf::Vector2f& newVelocity) {
+    GameObjectManager& manager = GameObjectManager::getInstance();
+    TransformStore& transforms = manager.getTransforms();
+    const std::uint32_t index = transformIndex();
+    if (transforms.velocityX[index] != newVelocity.x || transforms.velocityY[index] != newVelocity.y) {
+        transforms.velocityX[index] = newVelocity.x;
+        transforms.velocityY[index] = newVelocity.y;
+        manager.markChanged(handle, ChangeFlags::Velocity);
+    }
+}
+
+/**
+ * @brief Applies a force to the object until the next physics update.
+ * @param force The force to apply.
+ */
+void GameObject::addForce(const sf::Vector2f& force) {
+    TransformStore& transforms = GameObjectManager::getInstance().getTransforms();
+    const std::uint32_t index = transformIndex();
+    transforms.forceX[index] += force.x;
+    transforms.forceY[index] += force.y;
 }
@@ -8,37 +8,1092 @@
  *
  * Dependencies:
  *   - GameObjectManager.h: Header for the GameObjectManager class.
+ *   - JobSystem.h: Runs object updates in parallel.
+ *   - thread: Other threads yield while the main thread publishes their object.
+ *   - stdexcept: For reporting misuse of spawn, despawn and unregisterObject.
  */
 
 #include "../Include/GameObjectSystem/GameObjectManager.h"
+#include "../Include/JobSystem/JobSystem.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    /**
+     * Smallest number of objects updated by a single job.
+     */
+    constexpr std::size_t MinUpdateChunkSize = 64;
+}
+
+/**
+ * @brief Constructs the GameObjectManager.
+ * Creates the generic bucket used for objects of unregistered types.
+ */
+GameObjectManager::GameObjectManager() {
+    buckets.push_back({ {}, 0, &GameObjectManager::updateRangeVirtual, {} });
+
+    const std::size_t threadCount = KryptosEngine::JobSystem::getInstance().getThreadCount();
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        commandBuffers.push_back(std::make_unique<CommandBuffer>());
+        flushingBuffers.push_back(std::make_unique<CommandBuffer>());
+    }
+    changedByThread.resize(threadCount);
+    mainThread = std::this_thread::get_id();
+}
+
+/**
+ * @brief Update loop for objects of unregistered types, using virtual dispatch.
+ * @param objects The objects to update.
+ * @param count Number of objects in the range.
+ * @param deltaTime Time elapsed since the last frame.
+ */
+void GameObjectManager::updateRangeVirtual(GameObject* const* objects, std::size_t count, float deltaTime) {
+    for (std::size_t i = 0; i < count; ++i) {
+        objects[i]->update(deltaTime);
+    }
+}
+
+/**
+ * @brief Creates a bucket for a concrete type and moves existing objects of that type into it.
+ *
+ * Objects already classified into the generic bucket are re-examined once, so types may be
+ * registered after objects of that type exist.
+ * @param type The concrete type.
+ * @param updateRange The update loop for the type.
+ * @param describeComponents Builds the component layout of the type.
+ */
+void GameObjectManager::addTypeBucket(std::type_index type, void (*updateRange)(GameObject* const*, std::size_t, float),
+    ComponentLayout (*describeComponents)()) {
+    if (typeBuckets.find(type) != typeBuckets.end()) {
+        return;
+    }
+
+    const std::uint32_t bucket = static_cast<std::uint32_t>(buckets.size());
+    typeBuckets.emplace(type, bucket);
+    buckets.push_back({ {}, 0, updateRange, describeComponents() });
+
+    std::vector<GameObject*>& generic = buckets[GenericBucket].objects;
+    for (std::size_t i = generic.size(); i-- > 0;) {
+        GameObject* object = generic[i];
+        if (std::type_index(typeid(*object)) == type) {
+            removeFromBucket(object);
+            addToBucket(object, bucket);
+        }
+    }
+}
+
+/**
+ * @brief Exchanges two entries of the dense list, their transform data and their slots' indices.
+ * @param first Dense index of the first entry.
+ * @param second Dense index of the second entry.
+ */
+void GameObjectManager::swapDense(std::size_t first, std::size_t second) {
+    if (first == second) {
+        return;
+    }
+
+    std::swap(gameObjects[first], gameObjects[second]);
+    std::swap(denseToSlot[first], denseToSlot[second]);
+    transforms.swapEntries(first, second);
+    slots[denseToSlot[first]].denseIndex = static_cast<std::uint32_t>(first);
+    slots[denseToSlot[second]].denseIndex = static_cast<std::uint32_t>(second);
+}
+
+/**
+ * @brief Exchanges two entries of a bucket or of the unclassified list and their slots' indices.
+ * @param objects The list holding both entries.
+ * @param first Index of the first entry.
+ * @param second Index of the second entry.
+ */
+void GameObjectManager::swapInList(std::vector<GameObject*>& objects, std::size_t first, std::size_t second) {
+    if (first == second) {
+        return;
+    }
+
+    std::swap(objects[first], objects[second]);
+    slots[objects[first]->handle.index].bucketIndex = static_cast<std::uint32_t>(first);
+    slots[objects[second]->handle.index].bucketIndex = static_cast<std::uint32_t>(second);
+}
+
+/**
+ * @brief Appends an object to a bucket and records its position in the slot.
+ *
+ * Active objects are moved into the bucket's active partition.
+ * @param object The object to add.
+ * @param bucket Index of the bucket.
+ */
+void GameObjectManager::addToBucket(GameObject* object, std::uint32_t bucket) {
+    Slot& slot = slots[object->handle.index];
+    UpdateBucket& target = buckets[bucket];
+    slot.bucket = bucket;
+    slot.bucketIndex = static_cast<std::uint32_t>(target.objects.size());
+    target.objects.push_back(object);
+
+    if (slot.denseIndex < activeCount) {
+        swapInList(target.objects, slot.bucketIndex, target.activeCount);
+        ++target.activeCount;
+    }
+}
+
+/**
+ * @brief Removes an object from its bucket or from the unclassified list.
+ *
+ * Active objects are first moved to the end of the active partition, then the object
+ * is swapped with the last entry of the list and popped.
+ * @param object The object to remove.
+ */
+void GameObjectManager::removeFromBucket(GameObject* object) {
+    Slot& slot = slots[object->handle.index];
+
+    if (slot.bucket == GameObjectHandle::InvalidIndex) {
+        swapInList(unclassifiedObjects, slot.bucketIndex, unclassifiedObjects.size() - 1);
+        unclassifiedObjects.pop_back();
+    }
+    else {
+        UpdateBucket& bucket = buckets[slot.bucket];
+        if (slot.bucketIndex < bucket.activeCount) {
+            --bucket.activeCount;
+            swapInList(bucket.objects, slot.bucketIndex, bucket.activeCount);
+        }
+        swapInList(bucket.objects, slot.bucketIndex, bucket.objects.size() - 1);
+        bucket.objects.pop_back();
+    }
+
+    slot.bucket = GameObjectHandle::InvalidIndex;
+    slot.bucketIndex = GameObjectHandle::InvalidIndex;
+}
+
+/**
+ * @brief Applies moves recorded during updateAll to the spatial index.
+ *
+ * Every move also marks its object as changed, so only the change lists are scanned.
+ */
+void GameObjectManager::syncSpatialIndex() {
+    if (!spatialIndex) {
+        return;
+    }
+
+    for (const std::vector<GameObjectHandle>& changed : changedByThread) {
+        for (GameObjectHandle handle : changed) {
+            if (isValid(handle) && spatialDirty[handle.index] != 0) {
+                spatialDirty[handle.index] = 0;
+                const std::uint32_t denseIndex = slots[handle.index].denseIndex;
+                spatialIndex->update(handle, sf::Vector2f(transforms.positionX[denseIndex], transforms.positionY[denseIndex]));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Moves every unclassified object into the bucket of its concrete type.
+ *
+ * Objects whose type has no bucket go to the generic bucket.
+ */
+void GameObjectManager::classifyObjects() {
+    for (GameObject* object : unclassifiedObjects) {
+        const auto it = typeBuckets.find(std::type_index(typeid(*object)));
+        slots[object->handle.index].bucket = GameObjectHandle::InvalidIndex;
+        addToBucket(object, it != typeBuckets.end() ? it->second : GenericBucket);
+    }
+    unclassifiedObjects.clear();
+}
 
  /**
-  * @brief Registers a new game object.
+  * @brief Adds an object to the registry and writes its initial state, on the main thread.
   *
-  * Adds the game object to the internal list if it is not already registered.
-  * Ensures no duplicate registrations.
-  * @param object Pointer to the game object to register.
+  * Reuses a released slot when one is available, otherwise grows the slot table.
+  * The object is added to the active partition of the dense array, receives a handle for its
+  * slot, and then has its initial state written. Objects that already hold a live handle are
+  * not registered twice.
   */
-void GameObjectManager::registerObject(GameObject* object) {
-    if (std::find(gameObjects.begin(), gameObjects.end(), object) == gameObjects.end()) {
-        gameObjects.push_back(object);
+void GameObjectManager::addObject(GameObject* object, NameId name, const sf::Vector2f& position, bool active, float rotation, float mass, bool useGravity) {
+    if (object == nullptr || resolve(object->handle) == object) {
+        return;
+    }
+
+    std::uint32_t slotIndex;
+    if (!freeSlots.empty()) {
+        slotIndex = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else {
+        slotIndex = static_cast<std::uint32_t>(slots.size());
+        slots.push_back({ GameObjectHandle::InvalidIndex, 0, GameObjectHandle::InvalidIndex, GameObjectHandle::InvalidIndex, GameObjectHandle::InvalidIndex });
+        coldData.push_back({ NameTable::InvalidName, GameObjectHandle::InvalidIndex, nullptr });
+        spatialDirty.push_back(0);
+        changeFlags.push_back(0);
+        changeVersions.push_back(0);
+        lodElapsed.push_back(0.f);
+    }
+
+    Slot& slot = slots[slotIndex];
+    slot.denseIndex = static_cast<std::uint32_t>(gameObjects.size());
+    gameObjects.push_back(object);
+    denseToSlot.push_back(slotIndex);
+    transforms.pushBack(sf::Vector2f(0.f, 0.f), sf::Angle::Zero, 1.f, false);
+    swapDense(slot.denseIndex, activeCount);
+    ++activeCount;
+
+    // The bucket is chosen on the next update, once the object is fully constructed
+    slot.bucket = GameObjectHandle::InvalidIndex;
+    slot.bucketIndex = static_cast<std::uint32_t>(unclassifiedObjects.size());
+    unclassifiedObjects.push_back(object);
+    slot.pool = GameObjectHandle::InvalidIndex;
+    lodElapsed[slotIndex] = 0.f;
+
+    object->handle = { slotIndex, slot.generation };
+    markChanged(object->handle, ChangeFlags::Created);
+
+    if (name >= objectsByName.size()) {
+        objectsByName.resize(name + 1);
+    }
+    std::vector<GameObjectHandle>& namesakes = objectsByName[name];
+    ColdData& cold = coldData[slotIndex];
+    cold.name = name;
+    cold.nameIndex = static_cast<std::uint32_t>(namesakes.size());
+    cold.debugProbes = nullptr;
+    namesakes.push_back(object->handle);
+
+    if (spatialIndex) {
+        spatialIndex->insert(object->handle, sf::Vector2f(0.f, 0.f));
+    }
+
+    setObjectPosition(object->handle, position);
+    transforms.rotation[slot.denseIndex] = rotation;
+    transforms.mass[slot.denseIndex] = mass;
+    transforms.useGravity[slot.denseIndex] = useGravity ? 1 : 0;
+    setObjectActive(object, active);
+}
+
+/**
+ * @brief Registers a new game object with its initial state. Safe from any thread.
+ *
+ * Off the main thread nothing shared is touched, not even the NameTable: the state and the
+ * raw name are staged in a node owned by the object until submit queues it.
+ * @param object Pointer to the game object to register.
+ * @param name Name of the object.
+ * @param position Initial position.
+ * @param active Whether the object starts active.
+ * @param rotation Initial rotation, in radians.
+ * @param mass Initial mass.
+ * @param useGravity Initial gravity flag.
+ */
+void GameObjectManager::registerObject(GameObject* object, std::string_view name, const sf::Vector2f& position, bool active, float rotation, float mass, bool useGravity) {
+    if (object == nullptr) {
+        return;
     }
+    if (isMainThread()) {
+        addObject(object, NameTable::getInstance().intern(name), position, active, rotation, mass, useGravity);
+        return;
+    }
+    if (object->registration != nullptr) {
+        return;
+    }
+
+    PendingRegistration* registration = new PendingRegistration();
+    registration->object = object;
+    registration->name = std::string(name);
+    registration->position = position;
+    registration->active = active;
+    registration->rotation = rotation;
+    registration->mass = mass;
+    registration->useGravity = useGravity;
+    object->registration = registration;
+}
+
+/**
+ * @brief Records a debug probe registered by an object's constructor. Safe from any thread.
+ *
+ * The object's table so far is kept in its cold data, or in its registration node while it is
+ * staged off the main thread. Each constructor in a hierarchy looks its own type up once; when
+ * found, the base types' staged probes are already in that table and are dropped.
+ * @param object The object under construction.
+ * @param objectType The type whose constructor is running.
+ * @param name Display name of the member.
+ * @param valueType Type of the member.
+ * @param offset Byte offset of the member from the object's GameObject base.
+ */
+void GameObjectManager::addDebugProbe(GameObject* object, std::type_index objectType, std::string_view name, DebugValueType valueType, std::ptrdiff_t offset) {
+    PendingRegistration* registration = object->registration;
+    const bool staged = registration != nullptr && registration->state.load(std::memory_order_relaxed) == PendingRegistration::State::Staged;
+    const DebugProbeTable*& table = staged ? registration->debugProbeTable : coldData[object->handle.index].debugProbes;
+    if (table != nullptr && table->objectType == objectType) {
+        return;
+    }
+
+    if (const DebugProbeTable* found = DebugProbeRegistry::getInstance().find(objectType)) {
+        table = found;
+        if (staged) {
+            registration->debugProbes.clear();
+        }
+        else {
+            stagedDebugProbes.erase(object);
+        }
+        return;
+    }
+
+    std::vector<StagedDebugProbe>& pending = staged ? registration->debugProbes : stagedDebugProbes[object];
+    pending.push_back({ objectType, std::string(name), valueType, offset });
+}
+
+/**
+ * @brief Publishes the probe tables staged by an object constructed on the main thread.
+ * @param object A fully constructed object.
+ */
+void GameObjectManager::publishDebugProbes(GameObject* object) {
+    if (stagedDebugProbes.empty()) {
+        return;
+    }
+    const auto it = stagedDebugProbes.find(object);
+    if (it == stagedDebugProbes.end()) {
+        return;
+    }
+    ColdData& cold = coldData[object->handle.index];
+    cold.debugProbes = DebugProbeRegistry::getInstance().publish(cold.debugProbes, it->second);
+    stagedDebugProbes.erase(it);
+}
+
+/**
+ * @brief Completes the registration of a fully constructed object.
+ *
+ * Objects registered on the main thread carry no registration node.
+ * @param object A fully constructed game object.
+ */
+void GameObjectManager::submit(GameObject* object) {
+    if (object == nullptr) {
+        return;
+    }
+    if (object->registration == nullptr) {
+        if (isMainThread()) {
+            publishDebugProbes(object);
+            object->onRegistered();
+        }
+        return;
+    }
+
+    PendingRegistration::State expected = PendingRegistration::State::Staged;
+    if (object->registration->state.compare_exchange_strong(expected, PendingRegistration::State::Queued, std::memory_order_relaxed)) {
+        pendingRegistrations.push(object->registration);
+    }
+}
+
+/**
+ * @brief Destroys a game object. Safe from any thread, and never blocks.
+ *
+ * Off the main thread a published object is never deleted by the calling thread, since the
+ * main thread may be using it. Workers record it in their command buffer, so it goes with the
+ * frame's other deferred commands; other threads queue it, since they may not run a frame.
+ * @param object An object created with create, spawn or new, or nullptr.
+ */
+void GameObjectManager::destroy(GameObject* object) {
+    if (object == nullptr) {
+        return;
+    }
+    if (isMainThread()) {
+        if (updating && !object->handle.isNull()) {
+            // Other updates may still use the object, so it is deleted once they have finished
+            currentCommandBuffer().recordDestroy(object->handle);
+            return;
+        }
+        deleteObject(object);
+        return;
+    }
+
+    if (cancelRegistration(object)) {
+        delete object;
+        return;
+    }
+    if (KryptosEngine::JobSystem::getCurrentThreadIndex() != 0) {
+        currentCommandBuffer().recordDestroy(object->handle);
+        return;
+    }
+
+    PendingRegistration* request = new PendingRegistration();
+    request->object = object;
+    request->state.store(PendingRegistration::State::Destroy, std::memory_order_relaxed);
+    pendingRegistrations.push(request);
+}
+
+/**
+ * @brief Deletes an object, or returns it to its pool if it was spawned, on the main thread.
+ * @param object The object to delete.
+ */
+void GameObjectManager::deleteObject(GameObject* object) {
+    if (resolve(object->handle) == object && slots[object->handle.index].pool != GameObjectHandle::InvalidIndex) {
+        despawn(object);
+    }
+    else {
+        delete object;
+    }
+}
+
+/**
+ * @brief Publishes objects constructed and applies destructions requested on other threads.
+ *
+ * Nodes are handled in the order they were queued. Names are interned and staged debug probes
+ * registered here, so only the main thread writes those tables. While a registration is being
+ * published it is marked Publishing, so a concurrent destructor waits instead of freeing the
+ * node; once it is marked Published the node is not touched again. Destruction nodes were
+ * allocated by the destroying thread and are freed here.
+ */
+void GameObjectManager::publishRegistrations() {
+    PendingRegistration* node = pendingRegistrations.takeAll();
+    while (node != nullptr) {
+        PendingRegistration* next = node->next;
+
+        if (node->state.load(std::memory_order_acquire) == PendingRegistration::State::Destroy) {
+            GameObject* object = node->object;
+            delete node;
+            deleteObject(object);
+        }
+        else {
+            PendingRegistration::State expected = PendingRegistration::State::Queued;
+            if (node->state.compare_exchange_strong(expected, PendingRegistration::State::Publishing, std::memory_order_acq_rel)) {
+                GameObject* object = node->object;
+                addObject(object, NameTable::getInstance().intern(node->name), node->position, node->active,
+                    node->rotation, node->mass, node->useGravity);
+
+                setObjectDebugProbes(object->handle,
+                    DebugProbeRegistry::getInstance().publish(node->debugProbeTable, node->debugProbes));
+
+                // Still Publishing, so the constructing thread cannot destroy the object under the hook
+                object->onRegistered();
+                node->state.store(PendingRegistration::State::Published, std::memory_order_release);
+            }
+            else {
+                // Destroyed before it was published; the node is ours to free
+                delete node;
+            }
+        }
+        node = next;
+    }
+}
+
+/**
+ * @brief Withdraws an object's registration if the main thread has not published it yet.
+ *
+ * A staged node still belongs to the calling thread and is freed here. A queued node is
+ * marked Cancelled for the main thread to free. A node being published is waited for, which
+ * only lasts as long as the main thread's publishing of that one object.
+ * @param object The object.
+ * @return True if the object was never published and never will be.
+ */
+bool GameObjectManager::cancelRegistration(GameObject* object) {
+    PendingRegistration* registration = object->registration;
+    if (registration == nullptr) {
+        return false;
+    }
+
+    PendingRegistration::State state = registration->state.load(std::memory_order_acquire);
+    if (state == PendingRegistration::State::Staged) {
+        object->registration = nullptr;
+        delete registration;
+        return true;
+    }
+    if (state == PendingRegistration::State::Queued &&
+        registration->state.compare_exchange_strong(state, PendingRegistration::State::Cancelled, std::memory_order_acq_rel)) {
+        object->registration = nullptr;
+        return true;
+    }
+    while (state == PendingRegistration::State::Publishing) {
+        std::this_thread::yield();
+        state = registration->state.load(std::memory_order_acquire);
+    }
+    return false;
 }
 
 /**
  * @brief Unregisters an existing game object.
  *
- * Removes the game object from the internal list if it exists.
+ * Never waits for the main thread: off the main thread a published object cannot be removed
+ * safely, so that misuse is reported instead.
  * @param object Pointer to the game object to unregister.
+ * @throw std::logic_error if called off the main thread for a published object.
  */
 void GameObjectManager::unregisterObject(GameObject* object) {
-    gameObjects.erase(std::remove(gameObjects.begin(), gameObjects.end(), object), gameObjects.end());
+    if (object == nullptr || cancelRegistration(object)) {
+        return;
+    }
+
+    if (PendingRegistration* registration = object->registration) {
+        // Published; the node is no longer needed
+        object->registration = nullptr;
+        delete registration;
+    }
+    if (isMainThread()) {
+        removeObject(object);
+        return;
+    }
+    if (!object->handle.isNull()) {
+        throw std::logic_error("Published game objects cannot be deleted off the main thread; use destroy");
+    }
+}
+
+/**
+ * @brief Removes an object from the registry, on the main thread.
+ *
+ * Moves the object and its transform data to the back of the dense array, keeping the active
+ * partition packed, then pops it. Releases the slot and bumps its generation so outstanding
+ * handles become stale.
+ * @param object Pointer to the game object to remove.
+ */
+void GameObjectManager::removeObject(GameObject* object) {
+    if (object == nullptr || resolve(object->handle) != object) {
+        return;
+    }
+    if (!stagedDebugProbes.empty()) {
+        stagedDebugProbes.erase(object);
+    }
+
+    removeFromBucket(object);
+
+    const ColdData& cold = coldData[object->handle.index];
+    std::vector<GameObjectHandle>& namesakes = objectsByName[cold.name];
+    const std::uint32_t nameIndex = cold.nameIndex;
+    namesakes[nameIndex] = namesakes.back();
+    coldData[namesakes[nameIndex].index].nameIndex = nameIndex;
+    namesakes.pop_back();
+
+    if (spatialIndex) {
+        spatialIndex->remove(object->handle);
+    }
+
+    const std::uint32_t slotIndex = object->handle.index;
+    std::size_t denseIndex = slots[slotIndex].denseIndex;
+
+    if (denseIndex < activeCount) {
+        --activeCount;
+        swapDense(denseIndex, activeCount);
+        denseIndex = activeCount;
+    }
+    swapDense(denseIndex, gameObjects.size() - 1);
+    gameObjects.pop_back();
+    denseToSlot.pop_back();
+    transforms.popBack();
+
+    Slot& slot = slots[slotIndex];
+    slot.denseIndex = GameObjectHandle::InvalidIndex;
+    ++slot.generation;
+    spatialDirty[slotIndex] = 0;
+    changeFlags[slotIndex] = 0;
+    freeSlots.push_back(slotIndex);
+
+    object->handle = GameObjectHandle();
+}
+
+/**
+ * @brief Finds a live object by name.
+ * @param name The name to search for.
+ * @return The handle of an object with that name, or a null handle if there is none.
+ */
+GameObjectHandle GameObjectManager::findByName(std::string_view name) const {
+    return findByName(NameTable::getInstance().find(name));
+}
+
+/**
+ * @brief Finds a live object by interned name, without any hashing.
+ * @param nameId The interned name to search for.
+ * @return The handle of an object with that name, or a null handle if there is none.
+ */
+GameObjectHandle GameObjectManager::findByName(NameId nameId) const {
+    if (nameId >= objectsByName.size() || objectsByName[nameId].empty()) {
+        return GameObjectHandle();
+    }
+    return objectsByName[nameId].front();
+}
+
+/**
+ * @brief Finds every live object whose name starts with a prefix.
+ * @param prefix The prefix to match.
+ * @param results Receives the handles of the matching objects.
+ */
+void GameObjectManager::findAllByPrefix(std::string_view prefix, std::vector<GameObjectHandle>& results) const {
+    findAllByPrefix(prefix, results, prefixNameIds);
+}
+
+/**
+ * @brief Finds every live object whose name starts with a prefix, using a caller's scratch buffer.
+ *
+ * Matching names come from the NameTable's sorted index, so the cost depends on the number
+ * of matching names rather than on the number of objects.
+ * @param prefix The prefix to match.
+ * @param results Receives the handles of the matching objects.
+ * @param scratch Reusable buffer for the matching name IDs.
+ */
+void GameObjectManager::findAllByPrefix(std::string_view prefix, std::vector<GameObjectHandle>& results, std::vector<NameId>& scratch) const {
+    scratch.clear();
+    NameTable::getInstance().findWithPrefix(prefix, scratch);
+
+    for (NameId nameId : scratch) {
+        if (nameId < objectsByName.size()) {
+            results.insert(results.end(), objectsByName[nameId].begin(), objectsByName[nameId].end());
+        }
+    }
+}
+
+/**
+ * @brief Finds the pool for a concrete type, creating it and the type's update bucket on first use.
+ * @param type The concrete type.
+ * @param size Size of the type, in bytes.
+ * @param alignment Alignment of the type, in bytes.
+ * @param updateRange The update loop for the type.
+ * @param describeComponents Builds the component layout of the type.
+ * @return Index of the pool.
+ */
+std::uint32_t GameObjectManager::acquirePool(std::type_index type, std::size_t size, std::size_t alignment,
+    void (*updateRange)(GameObject* const*, std::size_t, float), ComponentLayout (*describeComponents)()) {
+    const auto it = typePools.find(type);
+    if (it != typePools.end()) {
+        return it->second;
+    }
+
+    addTypeBucket(type, updateRange, describeComponents);
+
+    const std::uint32_t poolIndex = static_cast<std::uint32_t>(pools.size());
+    pools.push_back(std::make_unique<ObjectPool>(type.name(), size, alignment));
+    typePools.emplace(type, poolIndex);
+    return poolIndex;
+}
+
+/**
+ * @brief Destroys a game object created with spawn and returns its memory to its pool.
+ *
+ * The block address is recovered with dynamic_cast<void*>, which yields the start of the
+ * most-derived object even when GameObject is not its first base.
+ * @param object The object to destroy.
+ * @throw std::logic_error if called off the main thread, or if the object was not created with spawn.
+ */
+void GameObjectManager::despawn(GameObject* object) {
+    if (object == nullptr) {
+        return;
+    }
+    if (!isMainThread()) {
+        throw std::logic_error("despawn must be called on the main thread; use despawnDeferred");
+    }
+    if (resolve(object->handle) != object || slots[object->handle.index].pool == GameObjectHandle::InvalidIndex) {
+        throw std::logic_error("despawn called on a game object that was not created with spawn");
+    }
+
+    ObjectPool& pool = *pools[slots[object->handle.index].pool];
+    void* block = dynamic_cast<void*>(object);
+    object->~GameObject();
+    pool.release(block);
+}
+
+/**
+ * @brief Activates or deactivates a game object.
+ *
+ * Swaps the object with the first inactive entry (activation) or the last active entry
+ * (deactivation) of the dense list, then does the same within its bucket.
+ * @param object The object to change.
+ * @param state True to activate the object, false to deactivate it.
+ */
+void GameObjectManager::setObjectActive(GameObject* object, bool state) {
+    if (resolve(object->handle) != object) {
+        return;
+    }
+
+    Slot& slot = slots[object->handle.index];
+    if ((slot.denseIndex < activeCount) == state) {
+        return;
+    }
+
+    markChanged(object->handle, ChangeFlags::Active);
+
+    if (state) {
+        swapDense(slot.denseIndex, activeCount);
+        ++activeCount;
+    }
+    else {
+        --activeCount;
+        swapDense(slot.denseIndex, activeCount);
+    }
+
+    if (slot.bucket != GameObjectHandle::InvalidIndex) {
+        UpdateBucket& bucket = buckets[slot.bucket];
+        if (state) {
+            swapInList(bucket.objects, slot.bucketIndex, bucket.activeCount);
+            ++bucket.activeCount;
+        }
+        else {
+            --bucket.activeCount;
+            swapInList(bucket.objects, slot.bucketIndex, bucket.activeCount);
+        }
+    }
+}
+
+/**
+ * @brief Ticks objects far from a focus object less often.
+ *
+ * Accumulated time is cleared, so time skipped before a previous call is not replayed.
+ * @param focus The object distances are measured from.
+ * @param halfRateDistance Distance beyond which objects tick every 2nd frame.
+ * @param quarterRateDistance Distance beyond which objects tick every 4th frame.
+ * @param eighthRateDistance Distance beyond which objects tick every 8th frame.
+ */
+void GameObjectManager::setUpdateLod(GameObjectHandle focus, float halfRateDistance, float quarterRateDistance, float eighthRateDistance) {
+    lodFocus = focus;
+    lodBandsSquared = { halfRateDistance * halfRateDistance, quarterRateDistance * quarterRateDistance, eighthRateDistance * eighthRateDistance };
+    std::fill(lodElapsed.begin(), lodElapsed.end(), 0.f);
+}
+
+/**
+ * @brief Updates every active object every frame again.
+ */
+void GameObjectManager::disableUpdateLod() {
+    lodFocus = GameObjectHandle();
+}
+
+/**
+ * @brief Picks the active objects of a bucket that tick this frame, by distance from the focus.
+ *
+ * An object with tick interval k ticks when the frame number plus its slot index is a
+ * multiple of k; slots are spread evenly over the residues, and so is the work. Each object
+ * accumulates the frame's time and hands the total to its next update, so objects with the
+ * same interval and history share a delta and can be updated by one loop.
+ * @param bucket The bucket.
+ * @param focus Position of the focus object.
+ * @param deltaTime Time elapsed since the last frame.
+ */
+void GameObjectManager::selectTickingObjects(const UpdateBucket& bucket, const sf::Vector2f& focus, float deltaTime) {
+    for (std::size_t band = 0; band < lodTicking.size(); ++band) {
+        lodTicking[band].clear();
+        lodDeltas[band].clear();
+    }
+
+    for (std::size_t i = 0; i < bucket.activeCount; ++i) {
+        GameObject* object = bucket.objects[i];
+        const std::uint32_t slotIndex = object->handle.index;
+        const std::uint32_t denseIndex = slots[slotIndex].denseIndex;
+        const float dx = transforms.positionX[denseIndex] - focus.x;
+        const float dy = transforms.positionY[denseIndex] - focus.y;
+        const float distanceSquared = dx * dx + dy * dy;
+
+        std::size_t band = 0;
+        while (band < lodBandsSquared.size() && distanceSquared > lodBandsSquared[band]) {
+            ++band;
+        }
+
+        float& elapsed = lodElapsed[slotIndex];
+        elapsed += deltaTime;
+        const std::uint32_t intervalMask = (1u << band) - 1;
+        if (((lodFrame + slotIndex) & intervalMask) == 0) {
+            lodTicking[band].push_back(object);
+            lodDeltas[band].push_back(elapsed);
+            elapsed = 0.f;
+        }
+    }
+}
+
+/**
+ * @brief Updates every registered game object.
+ *
+ * Publishes objects registered on other threads, classifies newly registered objects, then
+ * runs each bucket's update loop over its active partition. Each bucket is split into
+ * roughly four chunks per thread, so stealing can balance uneven update costs. Falls back
+ * to in-order loops when parallel updates are disabled.
+ *
+ * With update LOD on, each bucket's ticking objects are selected first, and the update loop
+ * runs over each run of objects sharing an accumulated delta.
+ * @param deltaTime Time elapsed since the last frame.
+ */
+void GameObjectManager::updateAll(float deltaTime) {
+    publishRegistrations();
+    classifyObjects();
+
+    KryptosEngine::JobSystem& jobSystem = KryptosEngine::JobSystem::getInstance();
+    GameObject* focus = resolve(lodFocus);
+    if (focus == nullptr && lodWasActive) {
+        // Objects tick every frame from now on; drop time a lost focus left them owing
+        std::fill(lodElapsed.begin(), lodElapsed.end(), 0.f);
+    }
+    lodWasActive = focus != nullptr;
+    const sf::Vector2f focusPosition = focus != nullptr ? focus->getPosition() : sf::Vector2f();
+
+    // Commands recorded by an update are ordered by the update's position in this frame's update order
+    std::uint64_t firstSource = 1;
+    const auto runUpdates = [this, &jobSystem, &firstSource](const UpdateBucket& bucket, GameObject* const* objects, const float* deltas, std::size_t count, float delta) {
+        const auto updateRuns = [this, &bucket, objects, deltas, delta, source = firstSource](std::size_t begin, std::size_t end) {
+            currentCommandBuffer().setSource(source + begin);
+            if (deltas == nullptr) {
+                bucket.updateRange(objects + begin, end - begin, delta);
+                return;
+            }
+            while (begin < end) {
+                std::size_t runEnd = begin + 1;
+                while (runEnd < end && deltas[runEnd] == deltas[begin]) {
+                    ++runEnd;
+                }
+                bucket.updateRange(objects + begin, runEnd - begin, deltas[begin]);
+                begin = runEnd;
+            }
+            };
+
+        firstSource += count;
+        if (!parallelUpdates) {
+            updateRuns(0, count);
+            return;
+        }
+        const std::size_t chunkSize = std::max(MinUpdateChunkSize, count / (jobSystem.getThreadCount() * 4));
+        jobSystem.parallelFor(count, chunkSize, updateRuns);
+        };
+
+    updating = true;
+    lastTickedCount = 0;
+
+    for (const UpdateBucket& bucket : buckets) {
+        if (focus == nullptr) {
+            runUpdates(bucket, bucket.objects.data(), nullptr, bucket.activeCount, deltaTime);
+            lastTickedCount += bucket.activeCount;
+            continue;
+        }
+
+        selectTickingObjects(bucket, focusPosition, deltaTime);
+        for (std::size_t band = 0; band < lodTicking.size(); ++band) {
+            runUpdates(bucket, lodTicking[band].data(), lodDeltas[band].data(), lodTicking[band].size(), deltaTime);
+            lastTickedCount += lodTicking[band].size();
+        }
+    }
+
+    if (focus != nullptr) {
+        ++lodFrame;
+    }
+    updating = false;
+    syncSpatialIndex();
+    flushCommands();
+}
+
+/**
+ * @brief Gets the command buffer owned by the calling thread.
+ */
+CommandBuffer& GameObjectManager::currentCommandBuffer() {
+    return *commandBuffers[KryptosEngine::JobSystem::getCurrentThreadIndex()];
+}
+
+/**
+ * @brief Requests that a spawned object be despawned at the next sync point.
+ *
+ * Only the slot table is read, which is safe during updateAll since no structural changes
+ * happen while updates run.
+ * @param object An object created with spawn or spawnDeferred.
+ * @throw std::logic_error if the object was not created with spawn.
+ */
+void GameObjectManager::despawnDeferred(GameObject* object) {
+    if (object == nullptr) {
+        return;
+    }
+    if (resolve(object->handle) != object || slots[object->handle.index].pool == GameObjectHandle::InvalidIndex) {
+        throw std::logic_error("despawnDeferred called on a game object that was not created with spawn");
+    }
+    currentCommandBuffer().recordDestroy(object->handle);
+}
+
+/**
+ * @brief Applies every deferred despawn, then every deferred spawn.
+ *
+ * Each pass swaps the recording buffers for empty ones, so commands recorded while applying
+ * land in the next pass rather than in a buffer being read. The commands of all buffers are
+ * merged by CommandOrder, and each chunk of updates runs on one thread, so the merged order
+ * is the order a single thread would have recorded them in. Despawns run first so their pool
+ * blocks can be reused by the spawns. Handles that went stale in the meantime, including
+ * duplicates, are skipped. If a spawn throws, the pass's remaining spawns are discarded.
+ */
+void GameObjectManager::flushCommands() {
+    const auto hasCommands = [](const std::unique_ptr<CommandBuffer>& buffer) {
+        return !buffer->empty();
+        };
+
+    while (std::any_of(commandBuffers.begin(), commandBuffers.end(), hasCommands)) {
+        commandBuffers.swap(flushingBuffers);
+
+        flushOrder.clear();
+        for (std::uint32_t b = 0; b < flushingBuffers.size(); ++b) {
+            const CommandBuffer& buffer = *flushingBuffers[b];
+            for (std::uint32_t i = 0; i < buffer.getDestroyCount(); ++i) {
+                flushOrder.push_back({ buffer.getDestroyOrder(i), b, i });
+            }
+        }
+        std::sort(flushOrder.begin(), flushOrder.end());
+        for (const FlushEntry& entry : flushOrder) {
+            if (GameObject* object = resolve(flushingBuffers[entry.buffer]->getDestroyHandle(entry.index))) {
+                deleteObject(object);
+            }
+        }
+
+        flushOrder.clear();
+        for (std::uint32_t b = 0; b < flushingBuffers.size(); ++b) {
+            const CommandBuffer& buffer = *flushingBuffers[b];
+            for (std::uint32_t i = 0; i < buffer.getSpawnCount(); ++i) {
+                flushOrder.push_back({ buffer.getSpawnOrder(i), b, i });
+            }
+        }
+        std::sort(flushOrder.begin(), flushOrder.end());
+        try {
+            for (const FlushEntry& entry : flushOrder) {
+                flushingBuffers[entry.buffer]->executeSpawn(entry.index);
+            }
+        }
+        catch (...) {
+            for (const std::unique_ptr<CommandBuffer>& buffer : flushingBuffers) {
+                buffer->clear();
+            }
+            throw;
+        }
+
+        for (const std::unique_ptr<CommandBuffer>& buffer : flushingBuffers) {
+            buffer->clear();
+        }
+    }
+}
+
+/**
+ * @brief Moves a game object and keeps the spatial index in sync.
+ *
+ * Setting the position an object already has does nothing. During updateAll only a per-slot flag is written, which is safe from worker threads
+ * because each update only moves its own object.
+ * @param handle A live handle.
+ * @param position The object's new position.
+ */
+void GameObjectManager::setObjectPosition(GameObjectHandle handle, const sf::Vector2f& position) {
+    const std::uint32_t denseIndex = slots[handle.index].denseIndex;
+    if (transforms.positionX[denseIndex] == position.x && transforms.positionY[denseIndex] == position.y) {
+        return;
+    }
+    transforms.positionX[denseIndex] = position.x;
+    transforms.positionY[denseIndex] = position.y;
+    markChanged(handle, ChangeFlags::Position);
+
+    if (!spatialIndex) {
+        return;
+    }
+    if (updating) {
+        spatialDirty[handle.index] = 1;
+    }
+    else {
+        spatialIndex->update(handle, position);
+    }
+}
+
+/**
+ * @brief Records that parts of an object changed during the current frame.
+ *
+ * The first change of a frame appends the object to the calling thread's change list.
+ * During updateAll each object is only changed by its own update, so the per-slot flags
+ * need no synchronisation and every object lands in exactly one list.
+ * @param handle A live handle.
+ * @param flags A combination of ChangeFlags bits.
+ */
+void GameObjectManager::markChanged(GameObjectHandle handle, std::uint8_t flags) {
+    std::uint8_t& current = changeFlags[handle.index];
+    if (current == 0) {
+        changedByThread[KryptosEngine::JobSystem::getCurrentThreadIndex()].push_back(handle);
+    }
+    current |= flags;
+    changeVersions[handle.index] = changeFrame;
+}
+
+/**
+ * @brief Lists every live object changed during the current frame.
+ *
+ * Moves the other threads' lists into the first one, skipping handles of objects destroyed
+ * since they changed, and compacts the first list the same way.
+ * @return The handles of the changed objects.
+ */
+const std::vector<GameObjectHandle>& GameObjectManager::getChangedObjects() {
+    std::vector<GameObjectHandle>& merged = changedByThread[0];
+    const auto isStale = [this](GameObjectHandle handle) {
+        return !isValid(handle) || changeFlags[handle.index] == 0;
+        };
+    merged.erase(std::remove_if(merged.begin(), merged.end(), isStale), merged.end());
+
+    for (std::size_t i = 1; i < changedByThread.size(); ++i) {
+        for (GameObjectHandle handle : changedByThread[i]) {
+            if (!isStale(handle)) {
+                merged.push_back(handle);
+            }
+        }
+        changedByThread[i].clear();
+    }
+    return merged;
+}
+
+/**
+ * @brief Ends the current frame's change tracking.
+ *
+ * Only the slots named in the change lists are cleared, so the cost follows the number of
+ * changed objects. A stale handle's slot is either free or owned by an object that is in a
+ * list itself, so clearing it is harmless.
+ */
+void GameObjectManager::clearChanges() {
+    for (std::vector<GameObjectHandle>& changed : changedByThread) {
+        for (GameObjectHandle handle : changed) {
+            changeFlags[handle.index] = 0;
+        }
+        changed.clear();
+    }
+    ++changeFrame;
+}
+
+/**
+ * @brief Installs the spatial index used to answer proximity queries.
+ * @param index The index to use, or nullptr to disable spatial indexing.
+ */
+void GameObjectManager::setSpatialIndex(std::unique_ptr<KryptosEngine::SpatialIndex> index) {
+    spatialIndex = std::move(index);
+    std::fill(spatialDirty.begin(), spatialDirty.end(), 0);
+
+    if (!spatialIndex) {
+        return;
+    }
+
+    spatialIndex->clear();
+    for (std::size_t i = 0; i < gameObjects.size(); ++i) {
+        spatialIndex->insert(gameObjects[i]->handle, sf::Vector2f(transforms.positionX[i], transforms.positionY[i]));
+    }
+}
+
+/**
+ * @brief Enables or disables parallel updates.
+ * @param enabled True to run updates on the JobSystem, false to run them on the calling thread.
+ */
+void GameObjectManager::setParallelUpdates(bool enabled) {
+    parallelUpdates = enabled;
+}
+
+/**
+ * @brief Checks whether updates run in parallel.
+ * @return True if updateAll uses the JobSystem.
+ */
+bool GameObjectManager::getParallelUpdates() const {
+    return parallelUpdates;
+}
+
+/**
+ * @brief Checks whether a handle still refers to a live game object.
+ * @param handle The handle to check.
+ * @return True if the handle's slot is occupied by the generation it was issued for.
+ */
+bool GameObjectManager::isValid(GameObjectHandle handle) const {
+    return handle.index < slots.size() &&
+        slots[handle.index].generation == handle.generation &&
+        slots[handle.index].denseIndex != GameObjectHandle::InvalidIndex;
+}
+
+/**
+ * @brief Resolves a handle to its game object.
+ * @param handle The handle to resolve.
+ * @return Pointer to the game object, or nullptr if the handle is null or stale.
+ */
+GameObject* GameObjectManager::resolve(GameObjectHandle handle) const {
+    return isValid(handle) ? gameObjects[slots[handle.index].denseIndex] : nullptr;
 }
 
 /**
  * @brief Provides access to all registered game objects.
  *
- * Returns a constant reference to the internal list of game objects.
+ * Returns a constant reference to the dense array of game objects. Unregistering an
+ * object moves the last entry into its place, so the order is not stable.
  * @return A constant reference to the vector of game object pointers.
  */
 const std::vector<GameObject*>& GameObjectManager::getGameObjects() const {
@@ -0,0 +1,97 @@
+/*
+ * NameTable.cpp - Kryptos Interned Names Implementation
+ * -----------------------------------------------------
+ * Implements interning and prefix lookups for the NameTable.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - NameTable.h: Header for the NameTable class.
+ *   - algorithm: For the sorted prefix index.
+ */
+
+#include "../Include/GameObjectSystem/NameTable.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Gets the ID of a name, adding it to the table if needed.
+ * New chunks are allocated on demand and published with a release store, after which
+ * their entries are only ever written once, before the ID that selects them is returned.
+ * @param name The name to intern.
+ * @return The name's ID.
+ * @throw std::length_error if the table is full.
+ */
+NameId NameTable::intern(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = lookup.find(name);
+    if (it != lookup.end()) {
+        return it->second;
+    }
+
+    if (count == ChunkSize * MaxChunks) {
+        throw std::length_error("NameTable is full");
+    }
+
+    const NameId id = static_cast<NameId>(count);
+    const std::size_t chunk = count >> ChunkShift;
+    if (chunk == chunkStorage.size()) {
+        chunkStorage.push_back(std::make_unique<std::string_view[]>(ChunkSize));
+        viewChunks[chunk].store(chunkStorage.back().get(), std::memory_order_release);
+    }
+
+    const std::string_view stored = names.emplace_back(name);
+    chunkStorage[chunk][count & (ChunkSize - 1)] = stored;
+    ++count;
+    lookup.emplace(stored, id);
+    sortedIds.push_back(id);
+    return id;
+}
+
+/**
+ * @brief Gets the ID of a name without adding it.
+ * @param name The name to look up.
+ * @return The name's ID, or InvalidName if it was never interned.
+ */
+NameId NameTable::find(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : InvalidName;
+}
+
+/**
+ * @brief Collects the IDs of every interned name starting with a prefix.
+ *
+ * New IDs are appended to the index by intern and only ordered here: the tail is sorted on
+ * its own, then merged with the sorted part through a reused buffer, which is linear in the
+ * size of the index instead of a full sort.
+ * @param prefix The prefix to match.
+ * @param results Receives the matching IDs, in name order.
+ */
+void NameTable::findWithPrefix(std::string_view prefix, std::vector<NameId>& results) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (sortedCount < sortedIds.size()) {
+        const auto byName = [this](NameId a, NameId b) {
+            return view(a) < view(b);
+            };
+        const auto tail = sortedIds.begin() + static_cast<std::ptrdiff_t>(sortedCount);
+        std::sort(tail, sortedIds.end(), byName);
+        if (sortedCount > 0) {
+            mergeBuffer.resize(sortedIds.size());
+            std::merge(sortedIds.begin(), tail, tail, sortedIds.end(), mergeBuffer.begin(), byName);
+            sortedIds.swap(mergeBuffer);
+        }
+        sortedCount = sortedIds.size();
+    }
+
+    auto it = std::lower_bound(sortedIds.begin(), sortedIds.end(), prefix, [this](NameId id, std::string_view value) {
+        return view(id) < value;
+        });
+    for (; it != sortedIds.end() && view(*it).substr(0, prefix.size()) == prefix; ++it) {
+        results.push_back(*it);
+    }
+}
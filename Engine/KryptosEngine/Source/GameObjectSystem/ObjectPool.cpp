@@ -0,0 +1,87 @@
+/*
+ * ObjectPool.cpp - Kryptos Fixed-Size Block Pool Implementation
+ * -------------------------------------------------------------
+ * Implements chunk allocation and the free list of the ObjectPool.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - ObjectPool.h: Header for the ObjectPool class.
+ *   - new: For aligned chunk allocation.
+ */
+
+#include "../Include/GameObjectSystem/ObjectPool.h"
+#include <algorithm>
+#include <new>
+
+/**
+ * @brief Constructs an empty pool.
+ *
+ * Blocks are at least large enough to hold the free list link and are rounded up to a
+ * multiple of the alignment, so every block in a chunk is aligned.
+ * @param typeName Display name of the pooled type.
+ * @param size Size of the pooled type, in bytes.
+ * @param alignment Alignment of the pooled type, in bytes.
+ * @param blocksPerChunk Number of blocks allocated at a time.
+ */
+ObjectPool::ObjectPool(const std::string& typeName, std::size_t size, std::size_t alignment, std::size_t blocksPerChunk)
+    : typeName(typeName),
+    blockAlignment(std::max(alignment, alignof(FreeBlock))),
+    blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1)),
+    freeList(nullptr),
+    liveCount(0),
+    highWaterMark(0) {
+    const std::size_t minimumSize = std::max(size, sizeof(FreeBlock));
+    blockSize = (minimumSize + blockAlignment - 1) / blockAlignment * blockAlignment;
+}
+
+/**
+ * @brief Frees every chunk.
+ */
+ObjectPool::~ObjectPool() {
+    for (void* chunk : chunks) {
+        ::operator delete(chunk, std::align_val_t(blockAlignment));
+    }
+}
+
+/**
+ * @brief Allocates a new chunk and pushes its blocks onto the free list.
+ *
+ * Blocks are pushed in reverse so they are handed out in address order.
+ */
+void ObjectPool::grow() {
+    std::byte* chunk = static_cast<std::byte*>(::operator new(blockSize * blocksPerChunk, std::align_val_t(blockAlignment)));
+    chunks.push_back(chunk);
+
+    for (std::size_t i = blocksPerChunk; i-- > 0;) {
+        FreeBlock* block = ::new (chunk + i * blockSize) FreeBlock{ freeList };
+        freeList = block;
+    }
+}
+
+/**
+ * @brief Takes a block from the pool, growing it if no free block is left.
+ * @return Pointer to uninitialised memory for one object.
+ */
+void* ObjectPool::acquire() {
+    if (freeList == nullptr) {
+        grow();
+    }
+
+    FreeBlock* block = freeList;
+    freeList = block->next;
+
+    ++liveCount;
+    highWaterMark = std::max(highWaterMark, liveCount);
+    return block;
+}
+
+/**
+ * @brief Returns a block to the pool.
+ * @param block A block previously returned by acquire().
+ */
+void ObjectPool::release(void* block) {
+    freeList = ::new (block) FreeBlock{ freeList };
+    --liveCount;
+}
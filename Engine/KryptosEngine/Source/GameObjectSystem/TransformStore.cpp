@@ -0,0 +1,92 @@
+/*
+ * TransformStore.cpp - Kryptos Game Object Component Storage Implementation
+ * -------------------------------------------------------------------------
+ * Implements the structural operations of the TransformStore columns.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - TransformStore.h: Header for the TransformStore structure.
+ */
+
+#include "../Include/GameObjectSystem/TransformStore.h"
+#include <utility>
+
+/**
+ * @brief Gets the number of entries in the store.
+ * @return The number of objects with transform data.
+ */
+std::size_t TransformStore::size() const {
+    return positionX.size();
+}
+
+/**
+ * @brief Reserves capacity in every column.
+ * @param capacity The number of entries to reserve.
+ */
+void TransformStore::reserve(std::size_t capacity) {
+    positionX.reserve(capacity);
+    positionY.reserve(capacity);
+    rotation.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    forceX.reserve(capacity);
+    forceY.reserve(capacity);
+    mass.reserve(capacity);
+    useGravity.reserve(capacity);
+}
+
+/**
+ * @brief Appends an entry to every column.
+ * @param position Initial position of the object.
+ * @param angle Initial rotation of the object.
+ * @param objectMass Mass of the object.
+ * @param gravity Whether the object is affected by gravity.
+ */
+void TransformStore::pushBack(const sf::Vector2f& position, const sf::Angle& angle, float objectMass, bool gravity) {
+    positionX.push_back(position.x);
+    positionY.push_back(position.y);
+    rotation.push_back(angle.asRadians());
+    velocityX.push_back(0.f);
+    velocityY.push_back(0.f);
+    forceX.push_back(0.f);
+    forceY.push_back(0.f);
+    mass.push_back(objectMass);
+    useGravity.push_back(gravity ? 1 : 0);
+}
+
+/**
+ * @brief Exchanges two entries in every column.
+ *
+ * Used by the GameObjectManager to keep active objects packed at the front
+ * and to move removed objects to the back before popping them.
+ * @param first Index of the first entry.
+ * @param second Index of the second entry.
+ */
+void TransformStore::swapEntries(std::size_t first, std::size_t second) {
+    std::swap(positionX[first], positionX[second]);
+    std::swap(positionY[first], positionY[second]);
+    std::swap(rotation[first], rotation[second]);
+    std::swap(velocityX[first], velocityX[second]);
+    std::swap(velocityY[first], velocityY[second]);
+    std::swap(forceX[first], forceX[second]);
+    std::swap(forceY[first], forceY[second]);
+    std::swap(mass[first], mass[second]);
+    std::swap(useGravity[first], useGravity[second]);
+}
+
+/**
+ * @brief Removes the last entry from every column.
+ */
+void TransformStore::popBack() {
+    positionX.pop_back();
+    positionY.pop_back();
+    rotation.pop_back();
+    velocityX.pop_back();
+    velocityY.pop_back();
+    forceX.pop_back();
+    forceY.pop_back();
+    mass.pop_back();
+    useGravity.pop_back();
+}
@@ -8,16 +8,23 @@
  *
  * Dependencies:
  *   - EngineInit.h: Header for the EngineInit class.
+ *   - GameObjectManager.h: For registering engine game object types.
+ *   - Player.h: Engine-provided game object type.
+ *   - PhysicsSystem.h: For reporting the physics integrator in use.
  */
 
 #include "../Include/Initialisers/EngineInit.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include "../Include/PlayerClass/Player.h"
+#include "../Include/PhysicsSystem/PhysicsSystem.h"
 
 namespace KryptosEngine {
 
     /**
      * @brief Initializes all engine systems.
      *
-     * Sets up the general logging system and the debug window logging system.
+     * Sets up the general logging system and the debug window logging system, and
+     * gives engine-provided game object types their own update buckets.
      * Additional systems can be initialized in this method as required.
      */
     void EngineInit::Initialise() {
@@ -29,6 +36,12 @@ namespace KryptosEngine {
         DebugWindowLogger::Init();
         DebugWindowLogger::GetLogger()->info("Debug Window logging initialized");
 
+        // Register engine game object types for devirtualized updates
+        GameObjectManager::getInstance().registerType<Player>();
+        Logger::GetLogger()->info("Game object types registered");
+
+        Logger::GetLogger()->info("Physics integrator using {}", PhysicsSystem::getSimdInstructionSet());
+
         // Future systems can be initialized here
         Logger::GetLogger()->info("Engine initialization completed");
     }
@@ -0,0 +1,260 @@
+/*
+ * JobSystem.cpp - Kryptos Work-Stealing Job System Implementation
+ * ---------------------------------------------------------------
+ * Implements the worker threads, queue management and work stealing.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - JobSystem.h: Header for the JobSystem class.
+ */
+
+#include "../Include/JobSystem/JobSystem.h"
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Index of the queue owned by the current thread. External threads share queue 0.
+         */
+        thread_local std::size_t currentQueueIndex = 0;
+
+        /**
+         * Initial capacity of each queue's ring buffer, enough for the chunks of a frame's
+         * parallel updates without growing.
+         */
+        constexpr std::size_t InitialQueueCapacity = 256;
+    }
+
+    /**
+     * @brief Constructs the JobSystem and starts its worker threads.
+     *
+     * One worker is started per hardware thread, minus the thread that submits work,
+     * since that thread executes jobs while it waits.
+     */
+    JobSystem::JobSystem()
+        : running(true),
+        pendingJobs(0) {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        const std::size_t workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+
+        for (std::size_t i = 0; i <= workerCount; ++i) {
+            queues.push_back(std::make_unique<WorkQueue>());
+            queues.back()->jobs.resize(InitialQueueCapacity);
+        }
+
+        for (std::size_t i = 1; i <= workerCount; ++i) {
+            workers.emplace_back(&JobSystem::workerLoop, this, i);
+        }
+    }
+
+    /**
+     * @brief Stops and joins every worker thread.
+     */
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            running = false;
+        }
+        wakeCondition.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Provides access to the singleton instance of JobSystem.
+     * @return A reference to the singleton instance.
+     */
+    JobSystem& JobSystem::getInstance() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    /**
+     * @brief Gets the number of threads that execute jobs, including the caller.
+     * @return The worker count plus one.
+     */
+    std::size_t JobSystem::getThreadCount() const {
+        return workers.size() + 1;
+    }
+
+    /**
+     * @brief Gets the index of the calling thread among the threads that execute jobs.
+     * @return The index of the queue owned by the calling thread.
+     */
+    std::size_t JobSystem::getCurrentThreadIndex() {
+        return currentQueueIndex;
+    }
+
+    /**
+     * @brief Queues a job after the newest one.
+     *
+     * A full buffer is doubled and its jobs unwrapped to start at the front.
+     * @param job The job to queue.
+     */
+    void JobSystem::WorkQueue::pushBack(const Job& job) {
+        if (count == jobs.size()) {
+            std::vector<Job> grown(jobs.empty() ? InitialQueueCapacity : jobs.size() * 2);
+            for (std::size_t i = 0; i < count; ++i) {
+                grown[i] = jobs[(head + i) & (jobs.size() - 1)];
+            }
+            jobs.swap(grown);
+            head = 0;
+        }
+        jobs[(head + count) & (jobs.size() - 1)] = job;
+        ++count;
+    }
+
+    /**
+     * @brief Takes the newest job.
+     * @param job Receives the job on success.
+     * @return False if the queue is empty.
+     */
+    bool JobSystem::WorkQueue::popBack(Job& job) {
+        if (count == 0) {
+            return false;
+        }
+        --count;
+        job = jobs[(head + count) & (jobs.size() - 1)];
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest job.
+     * @param job Receives the job on success.
+     * @return False if the queue is empty.
+     */
+    bool JobSystem::WorkQueue::popFront(Job& job) {
+        if (count == 0) {
+            return false;
+        }
+        job = jobs[head];
+        head = (head + 1) & (jobs.size() - 1);
+        --count;
+        return true;
+    }
+
+    /**
+     * @brief Main loop of a worker thread.
+     *
+     * Executes jobs from its own queue, steals from other queues when empty,
+     * and sleeps until new jobs are queued.
+     * @param queueIndex Index of the queue owned by the worker.
+     */
+    void JobSystem::workerLoop(std::size_t queueIndex) {
+        currentQueueIndex = queueIndex;
+
+        while (true) {
+            Job job;
+            if (takeJob(queueIndex, job)) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait(lock, [this]() {
+                return pendingJobs.load() > 0 || !running.load();
+                });
+
+            if (!running.load()) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Takes a job from the thread's own queue, or steals one from another queue.
+     *
+     * The owner takes the most recently queued job; thieves take the oldest.
+     * @param queueIndex Index of the queue owned by the calling thread.
+     * @param job Receives the job on success.
+     * @return True if a job was taken.
+     */
+    bool JobSystem::takeJob(std::size_t queueIndex, Job& job) {
+        {
+            WorkQueue& own = *queues[queueIndex];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.popBack(job)) {
+                --pendingJobs;
+                return true;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            WorkQueue& victim = *queues[(queueIndex + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.popFront(job)) {
+                --pendingJobs;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Executes a job and marks its chunk as finished.
+     * @param job The job to execute.
+     */
+    void JobSystem::execute(const Job& job) {
+        job.function(job.context, job.begin, job.end);
+        job.remaining->fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Splits a range into jobs, queues them and helps until they finish.
+     *
+     * Chunks are spread round-robin over every queue so workers start without stealing.
+     * Without worker threads the range is executed inline, in order.
+     * @param count Number of indices in the range.
+     * @param chunkSize Maximum number of indices per job.
+     * @param function Range body to invoke for each chunk.
+     * @param context Body object passed to the function.
+     */
+    void JobSystem::dispatch(std::size_t count, std::size_t chunkSize,
+        void (*function)(void*, std::size_t, std::size_t), void* context) {
+        if (count == 0) {
+            return;
+        }
+        if (chunkSize == 0) {
+            chunkSize = 1;
+        }
+        if (workers.empty() || count <= chunkSize) {
+            function(context, 0, count);
+            return;
+        }
+
+        const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        std::atomic<std::size_t> remaining(chunkCount);
+
+        for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end = begin + chunkSize < count ? begin + chunkSize : count;
+
+            WorkQueue& queue = *queues[chunk % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.pushBack({ function, context, begin, end, &remaining });
+            ++pendingJobs;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_all();
+
+        // Help with the work instead of blocking
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            Job job;
+            if (takeJob(currentQueueIndex, job)) {
+                execute(job);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+} // namespace KryptosEngine
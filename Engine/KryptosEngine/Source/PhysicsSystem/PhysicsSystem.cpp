@@ -0,0 +1,300 @@
+/*
+ * PhysicsSystem.cpp - Kryptos Rigid Body Physics Implementation
+ * -------------------------------------------------------------
+ * Implements the fixed-timestep loop and the scalar and SIMD integrators.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - PhysicsSystem.h: Header for the PhysicsSystem class.
+ *   - GameObjectManager.h: Owns the TransformStore being integrated.
+ *   - JobSystem.h: Splits integration across worker threads.
+ *   - immintrin.h / emmintrin.h: AVX and SSE2 intrinsics, when available.
+ */
+
+#include "../Include/PhysicsSystem/PhysicsSystem.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include "../Include/JobSystem/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define KRYPTOS_PHYSICS_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KRYPTOS_PHYSICS_SSE2 1
+#endif
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Smallest number of bodies handed to one job. A multiple of the AVX width, so
+         * only the final chunk has a scalar tail.
+         */
+        constexpr std::size_t MinIntegrationChunkSize = 1024;
+
+#if defined(KRYPTOS_PHYSICS_AVX) || defined(KRYPTOS_PHYSICS_SSE2)
+        /**
+         * @brief Expands four gravity flags into a lane mask: all bits set where the flag is non-zero.
+         */
+        inline __m128 gravityMask4(const std::uint8_t* flags) {
+            std::int32_t packed;
+            std::memcpy(&packed, flags, sizeof(packed));
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+            return _mm_castsi128_ps(_mm_cmpgt_epi32(wide, zero));
+        }
+#endif
+    }
+
+    /**
+     * @brief Private constructor for Singleton pattern.
+     *
+     * Defaults to 60 steps per second and gravity pointing down the screen.
+     */
+    PhysicsSystem::PhysicsSystem()
+        : fixedTimestep(1.f / 60.f),
+        accumulator(0.f),
+        maxStepsPerFrame(5),
+        gravity(0.f, 980.f),
+        simdEnabled(true),
+        lastBodyCount(0),
+        lastStepCount(0),
+        lastBodiesPerMillisecond(0.f) {
+    }
+
+    /**
+     * @brief Gets the singleton instance of the PhysicsSystem.
+     * @return Reference to the singleton instance.
+     */
+    PhysicsSystem& PhysicsSystem::getInstance() {
+        static PhysicsSystem instance;
+        return instance;
+    }
+
+    /**
+     * @brief Gets the name of the instruction set used by the SIMD path.
+     */
+    const char* PhysicsSystem::getSimdInstructionSet() {
+#if defined(KRYPTOS_PHYSICS_AVX)
+        return "AVX";
+#elif defined(KRYPTOS_PHYSICS_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+
+    /**
+     * @brief Integrates bodies [begin, end) with plain scalar code.
+     *
+     * The operations match the SIMD path one for one, so both produce the same results.
+     */
+    void PhysicsSystem::integrateScalar(const BodyArrays& bodies, std::size_t begin, std::size_t end,
+        const sf::Vector2f& gravity, float step) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const float mass = bodies.mass[i];
+            const float inverseMass = mass > 0.f ? 1.f / mass : 0.f;
+            const bool gravityOn = bodies.useGravity[i] != 0;
+
+            const float accelerationX = bodies.forceX[i] * inverseMass + (gravityOn ? gravity.x : 0.f);
+            const float accelerationY = bodies.forceY[i] * inverseMass + (gravityOn ? gravity.y : 0.f);
+
+            bodies.velocityX[i] += accelerationX * step;
+            bodies.velocityY[i] += accelerationY * step;
+            bodies.positionX[i] += bodies.velocityX[i] * step;
+            bodies.positionY[i] += bodies.velocityY[i] * step;
+        }
+    }
+
+    /**
+     * @brief Integrates bodies [begin, end) with SSE or AVX, finishing the tail with scalar code.
+     *
+     * The columns are not aligned, so unaligned loads and stores are used throughout.
+     */
+    void PhysicsSystem::integrateSimd(const BodyArrays& bodies, std::size_t begin, std::size_t end,
+        const sf::Vector2f& gravity, float step) {
+        std::size_t i = begin;
+
+#if defined(KRYPTOS_PHYSICS_AVX)
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 dt = _mm256_set1_ps(step);
+        const __m256 gravityX = _mm256_set1_ps(gravity.x);
+        const __m256 gravityY = _mm256_set1_ps(gravity.y);
+
+        for (; i + 8 <= end; i += 8) {
+            const __m256 mass = _mm256_loadu_ps(bodies.mass + i);
+            const __m256 inverseMass = _mm256_and_ps(_mm256_div_ps(one, mass), _mm256_cmp_ps(mass, zero, _CMP_GT_OQ));
+            const __m256 gravityOn = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(gravityMask4(bodies.useGravity + i)), gravityMask4(bodies.useGravity + i + 4), 1);
+
+            const __m256 accelerationX = _mm256_add_ps(
+                _mm256_mul_ps(_mm256_loadu_ps(bodies.forceX + i), inverseMass), _mm256_and_ps(gravityX, gravityOn));
+            const __m256 accelerationY = _mm256_add_ps(
+                _mm256_mul_ps(_mm256_loadu_ps(bodies.forceY + i), inverseMass), _mm256_and_ps(gravityY, gravityOn));
+
+            const __m256 velocityX = _mm256_add_ps(_mm256_loadu_ps(bodies.velocityX + i), _mm256_mul_ps(accelerationX, dt));
+            const __m256 velocityY = _mm256_add_ps(_mm256_loadu_ps(bodies.velocityY + i), _mm256_mul_ps(accelerationY, dt));
+            _mm256_storeu_ps(bodies.velocityX + i, velocityX);
+            _mm256_storeu_ps(bodies.velocityY + i, velocityY);
+            _mm256_storeu_ps(bodies.positionX + i, _mm256_add_ps(_mm256_loadu_ps(bodies.positionX + i), _mm256_mul_ps(velocityX, dt)));
+            _mm256_storeu_ps(bodies.positionY + i, _mm256_add_ps(_mm256_loadu_ps(bodies.positionY + i), _mm256_mul_ps(velocityY, dt)));
+        }
+#elif defined(KRYPTOS_PHYSICS_SSE2)
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 dt = _mm_set1_ps(step);
+        const __m128 gravityX = _mm_set1_ps(gravity.x);
+        const __m128 gravityY = _mm_set1_ps(gravity.y);
+
+        for (; i + 4 <= end; i += 4) {
+            const __m128 mass = _mm_loadu_ps(bodies.mass + i);
+            const __m128 inverseMass = _mm_and_ps(_mm_div_ps(one, mass), _mm_cmpgt_ps(mass, zero));
+            const __m128 gravityOn = gravityMask4(bodies.useGravity + i);
+
+            const __m128 accelerationX = _mm_add_ps(
+                _mm_mul_ps(_mm_loadu_ps(bodies.forceX + i), inverseMass), _mm_and_ps(gravityX, gravityOn));
+            const __m128 accelerationY = _mm_add_ps(
+                _mm_mul_ps(_mm_loadu_ps(bodies.forceY + i), inverseMass), _mm_and_ps(gravityY, gravityOn));
+
+            const __m128 velocityX = _mm_add_ps(_mm_loadu_ps(bodies.velocityX + i), _mm_mul_ps(accelerationX, dt));
+            const __m128 velocityY = _mm_add_ps(_mm_loadu_ps(bodies.velocityY + i), _mm_mul_ps(accelerationY, dt));
+            _mm_storeu_ps(bodies.velocityX + i, velocityX);
+            _mm_storeu_ps(bodies.velocityY + i, velocityY);
+            _mm_storeu_ps(bodies.positionX + i, _mm_add_ps(_mm_loadu_ps(bodies.positionX + i), _mm_mul_ps(velocityX, dt)));
+            _mm_storeu_ps(bodies.positionY + i, _mm_add_ps(_mm_loadu_ps(bodies.positionY + i), _mm_mul_ps(velocityY, dt)));
+        }
+#endif
+
+        integrateScalar(bodies, i, end, gravity, step);
+    }
+
+    /**
+     * @brief Runs one physics step over every active body.
+     * @param bodies The columns to integrate.
+     * @param count The number of active bodies.
+     */
+    void PhysicsSystem::step(const BodyArrays& bodies, std::size_t count) const {
+        JobSystem& jobSystem = JobSystem::getInstance();
+        const std::size_t perThread = count / (jobSystem.getThreadCount() * 4);
+        const std::size_t chunkSize = (std::max(MinIntegrationChunkSize, perThread) + 7) & ~static_cast<std::size_t>(7);
+
+        const sf::Vector2f stepGravity = gravity;
+        const float stepLength = fixedTimestep;
+        const bool simd = simdEnabled;
+
+        jobSystem.parallelFor(count, chunkSize, [&](std::size_t begin, std::size_t end) {
+            if (simd) {
+                integrateSimd(bodies, begin, end, stepGravity, stepLength);
+            }
+            else {
+                integrateScalar(bodies, begin, end, stepGravity, stepLength);
+            }
+            });
+    }
+
+    /**
+     * @brief Advances the simulation by a frame's worth of time.
+     *
+     * Time beyond the per-frame step limit is dropped so a long frame cannot trigger ever
+     * longer catch-up frames.
+     * @param deltaTime Time elapsed since the last frame.
+     */
+    void PhysicsSystem::update(float deltaTime) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        TransformStore& transforms = manager.getTransforms();
+        const std::size_t count = manager.getActiveCount();
+
+        accumulator += deltaTime;
+        lastBodyCount = count;
+        lastStepCount = 0;
+
+        const BodyArrays bodies = {
+            transforms.positionX.data(), transforms.positionY.data(),
+            transforms.velocityX.data(), transforms.velocityY.data(),
+            transforms.forceX.data(), transforms.forceY.data(),
+            transforms.mass.data(), transforms.useGravity.data()
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+        while (accumulator >= fixedTimestep && lastStepCount < maxStepsPerFrame) {
+            step(bodies, count);
+            accumulator -= fixedTimestep;
+            ++lastStepCount;
+        }
+        if (lastStepCount == maxStepsPerFrame) {
+            accumulator = std::min(accumulator, fixedTimestep);
+        }
+
+        if (lastStepCount > 0) {
+            const float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (milliseconds > 0.f) {
+                lastBodiesPerMillisecond = static_cast<float>(count * lastStepCount) / milliseconds;
+            }
+
+            // Bodies with a velocity or a force were integrated into a new state
+            SpatialIndex* spatialIndex = manager.getSpatialIndex();
+            const std::vector<GameObject*>& objects = manager.getGameObjects();
+            for (std::size_t i = 0; i < count; ++i) {
+                const bool moving = transforms.velocityX[i] != 0.f || transforms.velocityY[i] != 0.f;
+                if (moving || transforms.forceX[i] != 0.f || transforms.forceY[i] != 0.f) {
+                    manager.markChanged(objects[i]->getHandle(), ChangeFlags::Position | ChangeFlags::Velocity);
+                }
+                if (moving && spatialIndex) {
+                    spatialIndex->update(objects[i]->getHandle(), sf::Vector2f(transforms.positionX[i], transforms.positionY[i]));
+                }
+            }
+
+            // Forces act for every step of the frame they were applied in
+            std::fill(transforms.forceX.begin(), transforms.forceX.begin() + count, 0.f);
+            std::fill(transforms.forceY.begin(), transforms.forceY.begin() + count, 0.f);
+        }
+
+        broadphase.update();
+    }
+
+    /**
+     * @brief Integrates the active range once with both paths and compares the results.
+     * @return The largest absolute difference in position or velocity between the paths.
+     */
+    float PhysicsSystem::validateSimd() const {
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        const TransformStore& transforms = manager.getTransforms();
+        const std::size_t count = manager.getActiveCount();
+
+        std::vector<float> scalarState[4];
+        std::vector<float> simdState[4];
+        const std::vector<float>* columns[4] = { &transforms.positionX, &transforms.positionY, &transforms.velocityX, &transforms.velocityY };
+        for (int c = 0; c < 4; ++c) {
+            scalarState[c].assign(columns[c]->begin(), columns[c]->begin() + count);
+            simdState[c] = scalarState[c];
+        }
+
+        const BodyArrays scalarBodies = {
+            scalarState[0].data(), scalarState[1].data(), scalarState[2].data(), scalarState[3].data(),
+            transforms.forceX.data(), transforms.forceY.data(), transforms.mass.data(), transforms.useGravity.data()
+        };
+        const BodyArrays simdBodies = {
+            simdState[0].data(), simdState[1].data(), simdState[2].data(), simdState[3].data(),
+            transforms.forceX.data(), transforms.forceY.data(), transforms.mass.data(), transforms.useGravity.data()
+        };
+        integrateScalar(scalarBodies, 0, count, gravity, fixedTimestep);
+        integrateSimd(simdBodies, 0, count, gravity, fixedTimestep);
+
+        float maxError = 0.f;
+        for (int c = 0; c < 4; ++c) {
+            for (std::size_t i = 0; i < count; ++i) {
+                maxError = std::max(maxError, std::abs(scalarState[c][i] - simdState[c][i]));
+            }
+        }
+        return maxError;
+    }
+
+} // namespace KryptosEngine
@@ -0,0 +1,292 @@
+/*
+ * SweepAndPrune.cpp - Kryptos Sweep-and-Prune Broadphase Implementation
+ * ---------------------------------------------------------------------
+ * Implements proxy bookkeeping, the incremental endpoint sort, the sweep
+ * and the pair cache comparison of the SweepAndPrune broadphase.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SweepAndPrune.h: Header for the SweepAndPrune class.
+ *   - GameObjectManager.h: Supplies object positions, liveness and active state.
+ *   - algorithm: For sorting and filtering endpoint and pair lists.
+ */
+
+#include "../Include/PhysicsSystem/SweepAndPrune.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include <algorithm>
+#include <utility>
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Marks a slot with no proxy.
+         */
+        constexpr std::uint32_t NoProxy = GameObjectHandle::InvalidIndex;
+
+        /**
+         * Number of newly added endpoints above which a full sort beats the insertion sort.
+         */
+        constexpr std::size_t FullSortThreshold = 64;
+    }
+
+    /**
+     * @brief Packs two proxy indices into an order-independent pair key.
+     */
+    std::uint64_t SweepAndPrune::pairKey(std::uint32_t a, std::uint32_t b) {
+        if (a > b) {
+            std::swap(a, b);
+        }
+        return (static_cast<std::uint64_t>(a) << 32) | b;
+    }
+
+    /**
+     * @brief Orders endpoints by value, with min endpoints first on ties so touching boxes overlap.
+     */
+    bool SweepAndPrune::endpointLess(const Endpoint& a, const Endpoint& b) {
+        return a.value < b.value || (a.value == b.value && (a.data & 1u) < (b.data & 1u));
+    }
+
+    /**
+     * @brief Appends an event for a pair key.
+     */
+    void SweepAndPrune::emit(CollisionEvent::Type type, std::uint64_t key) {
+        const std::uint32_t a = static_cast<std::uint32_t>(key >> 32);
+        const std::uint32_t b = static_cast<std::uint32_t>(key);
+        events.push_back({ type, proxies[a].handle, proxies[b].handle });
+    }
+
+    /**
+     * @brief Adds a collider to an object, or replaces its existing bounds.
+     * @param handle The object's handle.
+     * @param localBounds The collider bounds relative to the object's position.
+     */
+    void SweepAndPrune::addCollider(GameObjectHandle handle, const sf::FloatRect& localBounds) {
+        if (handle.index >= proxyBySlot.size()) {
+            proxyBySlot.resize(handle.index + 1, NoProxy);
+        }
+
+        if (proxyBySlot[handle.index] != NoProxy && proxies[proxyBySlot[handle.index]].handle != handle) {
+            // The slot was reused by a new object before the stale proxy was dropped
+            releaseProxy(proxyBySlot[handle.index]);
+        }
+        if (proxyBySlot[handle.index] != NoProxy) {
+            proxies[proxyBySlot[handle.index]].localBounds = localBounds;
+            return;
+        }
+
+        // Re-adding a collider removed this frame revives its proxy, so its overlaps continue
+        for (std::size_t i = 0; i < releasedProxies.size(); ++i) {
+            Proxy& released = proxies[releasedProxies[i]];
+            if (released.handle == handle) {
+                released.localBounds = localBounds;
+                released.live = true;
+                proxyBySlot[handle.index] = releasedProxies[i];
+                releasedProxies[i] = releasedProxies.back();
+                releasedProxies.pop_back();
+                return;
+            }
+        }
+
+        std::uint32_t proxyIndex;
+        if (!freeProxies.empty()) {
+            proxyIndex = freeProxies.back();
+            freeProxies.pop_back();
+        }
+        else {
+            proxyIndex = static_cast<std::uint32_t>(proxies.size());
+            proxies.emplace_back();
+        }
+
+        // Endpoint values are filled in and sorted into place by the next update
+        proxies[proxyIndex] = { handle, localBounds, 0.f, 0.f, 0.f, 0.f, false, true, 0 };
+        endpoints.push_back({ 0.f, proxyIndex << 1 });
+        endpoints.push_back({ 0.f, (proxyIndex << 1) | 1u });
+        unsortedEndpoints += 2;
+        proxyBySlot[handle.index] = proxyIndex;
+    }
+
+    /**
+     * @brief Removes an object's collider.
+     * @param handle The object's handle.
+     */
+    void SweepAndPrune::removeCollider(GameObjectHandle handle) {
+        if (hasCollider(handle)) {
+            releaseProxy(proxyBySlot[handle.index]);
+        }
+    }
+
+    /**
+     * @brief Checks whether an object has a collider.
+     * @param handle The object's handle.
+     * @return True if the object has a collider.
+     */
+    bool SweepAndPrune::hasCollider(GameObjectHandle handle) const {
+        return handle.index < proxyBySlot.size() && proxyBySlot[handle.index] != NoProxy &&
+            proxies[proxyBySlot[handle.index]].handle == handle;
+    }
+
+    /**
+     * @brief Detaches a proxy from its object. It is freed by the next update.
+     *
+     * The proxy keeps its handle and endpoints until then, so the update can still report
+     * end events for its pairs, which drop out of the sweep because the proxy is disabled.
+     */
+    void SweepAndPrune::releaseProxy(std::uint32_t proxyIndex) {
+        Proxy& proxy = proxies[proxyIndex];
+        proxyBySlot[proxy.handle.index] = NoProxy;
+        proxy.enabled = false;
+        proxy.live = false;
+        releasedProxies.push_back(proxyIndex);
+    }
+
+    /**
+     * @brief Removes the endpoints of released proxies and makes the proxies reusable.
+     */
+    void SweepAndPrune::freeReleasedProxies() {
+        if (releasedProxies.empty()) {
+            return;
+        }
+
+        endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [this](const Endpoint& endpoint) {
+            return !proxies[endpoint.data >> 1].live;
+            }), endpoints.end());
+
+        for (std::uint32_t proxyIndex : releasedProxies) {
+            proxies[proxyIndex].handle = GameObjectHandle();
+            freeProxies.push_back(proxyIndex);
+        }
+        releasedProxies.clear();
+    }
+
+    /**
+     * @brief Refreshes every proxy's world bounds from the TransformStore.
+     *
+     * Proxies whose object has been destroyed are released here.
+     */
+    void SweepAndPrune::refreshBounds() {
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        const TransformStore& transforms = manager.getTransforms();
+
+        for (std::uint32_t i = 0; i < proxies.size(); ++i) {
+            Proxy& proxy = proxies[i];
+            if (!proxy.live) {
+                continue;
+            }
+            if (!manager.isValid(proxy.handle)) {
+                releaseProxy(i);
+                continue;
+            }
+
+            const std::uint32_t denseIndex = manager.getDenseIndex(proxy.handle);
+            proxy.enabled = denseIndex < manager.getActiveCount();
+            proxy.minX = transforms.positionX[denseIndex] + proxy.localBounds.position.x;
+            proxy.minY = transforms.positionY[denseIndex] + proxy.localBounds.position.y;
+            proxy.maxX = proxy.minX + proxy.localBounds.size.x;
+            proxy.maxY = proxy.minY + proxy.localBounds.size.y;
+        }
+
+        for (Endpoint& endpoint : endpoints) {
+            const Proxy& proxy = proxies[endpoint.data >> 1];
+            endpoint.value = (endpoint.data & 1u) ? proxy.maxX : proxy.minX;
+        }
+    }
+
+    /**
+     * @brief Restores endpoint order, with an insertion sort unless many endpoints were added.
+     *
+     * The insertion sort runs in O(n + swaps); with small movements each endpoint moves only
+     * a few places. Newly added endpoints can travel the whole list, so a bulk insertion
+     * falls back to a full sort.
+     */
+    void SweepAndPrune::sortEndpoints() {
+        const bool bulkInsert = unsortedEndpoints > FullSortThreshold;
+        unsortedEndpoints = 0;
+        if (bulkInsert) {
+            std::sort(endpoints.begin(), endpoints.end(), endpointLess);
+            return;
+        }
+
+        for (std::size_t i = 1; i < endpoints.size(); ++i) {
+            const Endpoint endpoint = endpoints[i];
+            std::size_t j = i;
+            while (j > 0 && endpointLess(endpoint, endpoints[j - 1])) {
+                endpoints[j] = endpoints[j - 1];
+                --j;
+            }
+            endpoints[j] = endpoint;
+        }
+    }
+
+    /**
+     * @brief Sweeps the endpoints and collects the overlapping pairs into currentPairs.
+     *
+     * Every proxy whose min endpoint has been passed but whose max has not overlaps on X with
+     * the proxy being opened, so only those are tested on Y.
+     */
+    void SweepAndPrune::sweep() {
+        currentPairs.clear();
+        openProxies.clear();
+
+        for (const Endpoint& endpoint : endpoints) {
+            const std::uint32_t proxyIndex = endpoint.data >> 1;
+            Proxy& proxy = proxies[proxyIndex];
+            if (!proxy.enabled) {
+                continue;
+            }
+
+            if (endpoint.data & 1u) {
+                const std::uint32_t last = openProxies.back();
+                openProxies[proxy.sweepIndex] = last;
+                proxies[last].sweepIndex = proxy.sweepIndex;
+                openProxies.pop_back();
+                continue;
+            }
+
+            for (std::uint32_t otherIndex : openProxies) {
+                const Proxy& other = proxies[otherIndex];
+                if (proxy.minY <= other.maxY && other.minY <= proxy.maxY) {
+                    currentPairs.push_back(pairKey(proxyIndex, otherIndex));
+                }
+            }
+            proxy.sweepIndex = static_cast<std::uint32_t>(openProxies.size());
+            openProxies.push_back(proxyIndex);
+        }
+
+        std::sort(currentPairs.begin(), currentPairs.end());
+    }
+
+    /**
+     * @brief Updates the broadphase from current object positions.
+     *
+     * Both pair lists are sorted, so begin and end events fall out of a single merge.
+     * Colliders of objects destroyed since the last update are removed here.
+     */
+    void SweepAndPrune::update() {
+        events.clear();
+        refreshBounds();
+        sortEndpoints();
+        sweep();
+
+        auto previous = pairs.begin();
+        auto current = currentPairs.begin();
+        while (previous != pairs.end() || current != currentPairs.end()) {
+            if (current == currentPairs.end() || (previous != pairs.end() && *previous < *current)) {
+                emit(CollisionEvent::Type::EndOverlap, *previous++);
+            }
+            else if (previous == pairs.end() || *current < *previous) {
+                emit(CollisionEvent::Type::BeginOverlap, *current++);
+            }
+            else {
+                ++previous;
+                ++current;
+            }
+        }
+
+        pairs.swap(currentPairs);
+        freeReleasedProxies();
+    }
+
+} // namespace KryptosEngine
@@ -9,15 +9,19 @@
  * Dependencies:
  *   - Keyboard.hpp: For handling player input.
  *   - Player.h: Header for the Player class.
+ *   - PhysicsSystem.h: For registering the player's collider.
  */
 
 #include <SFML/Window/Keyboard.hpp>
 #include "../Include/PlayerClass/Player.h"
+#include "../Include/PhysicsSystem/PhysicsSystem.h"
 
  /**
   * @brief Constructs a Player object with default attributes.
   *
-  * Loads the player's texture, initializes its sprite renderer, and registers debug-tracked variables.
+  * Registers debug-tracked variables. The texture and collider are set up by onRegistered,
+  * since the constructor may run off the main thread.
+ * Players move under direct keyboard control, so they are not affected by gravity.
   * @param name The name of the player.
   * @param position The initial position of the player.
   * @param texturePath Path to the texture used for the player's sprite.
@@ -26,16 +30,14 @@ Player::Player(
     const std::string& name,
     const sf::Vector2f& position,
     const std::string& texturePath)
-    : GameObject(name, position, active, rotation, mass, useGravity),
+    : GameObject(name, position, true, sf::degrees(0.f), 1.f, false),
     health(100.f),
     attackSpeed(1.f),
     movementSpeed(200.f),
     attackMultiplier(1.f),
     jumpMultiplier(1.f),
-    spriteRenderer() {
-    spriteRenderer.loadTexture(texturePath);
-    spriteRenderer.setPosition(position);
-
+    spriteRenderer(),
+    texturePath(texturePath) {
     // Register variables for debugging in the debug window
     registerDebugVariable("Health: ", health);
     registerDebugVariable("Attack Speed: ", attackSpeed);
@@ -70,16 +72,52 @@ void Player::update(float deltaTime) {
         movement.y -= jumpMultiplier * 300.f * deltaTime; // Example jump force
     }
 
-    // Update position and sprite
-    position += movement;
-    spriteRenderer.setPosition(position);
+    // Update position; the sprite follows in draw
+    if (movement != sf::Vector2f(0.f, 0.f)) {
+        setPosition(getPosition() + movement);
+    }
+}
+
+/**
+ * @brief Starts loading the player's texture and adds its collider, once the player has a handle.
+ *
+ * The texture loads in the background, so spawning never waits on the disk. The sprite's
+ * bounds are used as the player's collider, fitted to the placeholder first and refitted
+ * when the real texture replaces it.
+ */
+void Player::onRegistered() {
+    // Anchored at the top-left corner whatever the size of the texture shown
+    spriteRenderer.setRelativeOrigin(sf::Vector2f(0.f, 0.f));
+    spriteRenderer.setTextureChangedCallback([this]() {
+        fitColliderToSprite();
+        });
+    spriteRenderer.loadTextureAsync(texturePath);
+    spriteRenderer.setPosition(getPosition());
+    fitColliderToSprite();
+}
+
+/**
+ * @brief Sets the player's collider to the bounds of the sprite currently shown.
+ *
+ * Adding a collider again replaces its bounds.
+ */
+void Player::fitColliderToSprite() {
+    KryptosEngine::PhysicsSystem::getInstance().getBroadphase().addCollider(getHandle(), spriteRenderer.getOffsetBounds());
 }
 
 /**
  * @brief Renders the player using the provided render window.
+ *
+ * A texture that finished loading is swapped in first. The sprite is moved whenever it is not
+ * at the player's position, so moves made while the player was inactive or not drawn are
+ * picked up too.
  * @param window The render window where the player is drawn.
  */
 void Player::draw(sf::RenderWindow& window) {
+    spriteRenderer.updatePendingTexture();
+    if (spriteRenderer.getPosition() != getPosition()) {
+        spriteRenderer.setPosition(getPosition());
+    }
     spriteRenderer.draw(window);
 }
 
@@ -0,0 +1,450 @@
+/*
+ * SceneGraph.cpp - Kryptos Transform Hierarchy Implementation
+ * -----------------------------------------------------------
+ * Implements attachment, the breadth-first node layout and the dirty-flag
+ * driven world transform pass of the SceneGraph.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SceneGraph.h: Header for the SceneGraph class.
+ *   - GameObjectManager.h: Owns the TransformStore holding world transforms.
+ *   - JobSystem.h: Updates independent trees in parallel.
+ *   - cmath: For rotating local positions.
+ *   - stdexcept: For rejecting cyclic attachments.
+ */
+
+#include "../Include/SceneSystem/SceneGraph.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include "../Include/JobSystem/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Marks a missing node or a root's parent.
+         */
+        constexpr std::uint32_t NoNode = GameObjectHandle::InvalidIndex;
+
+        /**
+         * Node count below which trees are updated on the calling thread.
+         */
+        constexpr std::size_t ParallelNodeThreshold = 1024;
+    }
+
+    /**
+     * @brief Gets the singleton instance of the SceneGraph.
+     * @return Reference to the singleton instance.
+     */
+    SceneGraph& SceneGraph::getInstance() {
+        static SceneGraph instance;
+        return instance;
+    }
+
+    /**
+     * @brief Finds the node of a live handle.
+     * @return Index of the node, or InvalidIndex if the object is not in the graph.
+     */
+    std::uint32_t SceneGraph::findNode(GameObjectHandle handle) const {
+        if (handle.index >= nodeBySlot.size()) {
+            return NoNode;
+        }
+        const std::uint32_t nodeIndex = nodeBySlot[handle.index];
+        return nodeIndex != NoNode && nodes[nodeIndex].handle == handle ? nodeIndex : NoNode;
+    }
+
+    /**
+     * @brief Finds the node of an object, adding a root node for it if needed.
+     *
+     * New nodes are appended; they are moved into place by the next layout rebuild.
+     * @return Index of the node.
+     */
+    std::uint32_t SceneGraph::acquireNode(GameObjectHandle handle) {
+        const std::uint32_t existing = findNode(handle);
+        if (existing != NoNode) {
+            return existing;
+        }
+
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        const TransformStore& transforms = manager.getTransforms();
+        const std::uint32_t denseIndex = manager.getDenseIndex(handle);
+        const float x = transforms.positionX[denseIndex];
+        const float y = transforms.positionY[denseIndex];
+        const float rotation = transforms.rotation[denseIndex];
+
+        const std::uint32_t nodeIndex = static_cast<std::uint32_t>(nodes.size());
+        nodes.push_back({ handle, NoNode, NoNode, 0, x, y, rotation, x, y, rotation,
+            std::cos(rotation), std::sin(rotation), 0, false });
+
+        if (handle.index >= nodeBySlot.size()) {
+            nodeBySlot.resize(handle.index + 1, NoNode);
+        }
+        nodeBySlot[handle.index] = nodeIndex;
+        structureDirty = true;
+        return nodeIndex;
+    }
+
+    /**
+     * @brief Attaches an object to a parent, keeping its current world transform.
+     * @param child The object to attach.
+     * @param parent The new parent.
+     * @throw std::logic_error if the attachment would create a cycle.
+     */
+    void SceneGraph::attach(GameObjectHandle child, GameObjectHandle parent) {
+        if (parent.isNull()) {
+            detach(child);
+            return;
+        }
+
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        if (!manager.isValid(child) || !manager.isValid(parent)) {
+            return;
+        }
+        if (child == parent) {
+            throw std::logic_error("SceneGraph::attach: an object cannot be its own parent");
+        }
+
+        const std::uint32_t childNode = acquireNode(child);
+        const std::uint32_t parentNode = acquireNode(parent);
+        for (std::uint32_t ancestor = parentNode; ancestor != NoNode; ancestor = nodes[ancestor].parent) {
+            if (ancestor == childNode) {
+                throw std::logic_error("SceneGraph::attach: attaching an object to its own descendant");
+            }
+        }
+
+        // Derive the local transform that keeps the child where it currently is
+        const TransformStore& transforms = manager.getTransforms();
+        const std::uint32_t childDense = manager.getDenseIndex(child);
+        const std::uint32_t parentDense = manager.getDenseIndex(parent);
+        const float parentRotation = transforms.rotation[parentDense];
+        const float offsetX = transforms.positionX[childDense] - transforms.positionX[parentDense];
+        const float offsetY = transforms.positionY[childDense] - transforms.positionY[parentDense];
+        const float c = std::cos(parentRotation);
+        const float s = std::sin(parentRotation);
+
+        Node& node = nodes[childNode];
+        node.parent = parentNode;
+        node.localX = offsetX * c + offsetY * s;
+        node.localY = -offsetX * s + offsetY * c;
+        node.localRotation = transforms.rotation[childDense] - parentRotation;
+        node.dirty = true;
+        structureDirty = true;
+    }
+
+    /**
+     * @brief Detaches an object from its parent, keeping its current world transform.
+     * @param child The object to detach.
+     */
+    void SceneGraph::detach(GameObjectHandle child) {
+        const std::uint32_t nodeIndex = findNode(child);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            return;
+        }
+        nodes[nodeIndex].parent = NoNode;
+        structureDirty = true;
+    }
+
+    /**
+     * @brief Gets an object's parent.
+     * @return The parent's handle, or a null handle if the object has no parent.
+     */
+    GameObjectHandle SceneGraph::getParent(GameObjectHandle child) const {
+        const std::uint32_t nodeIndex = findNode(child);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            return GameObjectHandle();
+        }
+        return nodes[nodes[nodeIndex].parent].handle;
+    }
+
+    /**
+     * @brief Collects an object's children.
+     *
+     * Uses the contiguous child range when the layout is current, and scans the nodes otherwise.
+     * @param parent The object whose children to collect.
+     * @param results Receives the children's handles.
+     */
+    void SceneGraph::getChildren(GameObjectHandle parent, std::vector<GameObjectHandle>& results) const {
+        const std::uint32_t nodeIndex = findNode(parent);
+        if (nodeIndex == NoNode) {
+            return;
+        }
+
+        if (!structureDirty) {
+            const Node& node = nodes[nodeIndex];
+            for (std::uint32_t i = 0; i < node.childCount; ++i) {
+                results.push_back(nodes[node.firstChild + i].handle);
+            }
+            return;
+        }
+
+        for (const Node& node : nodes) {
+            if (node.parent == nodeIndex && !node.handle.isNull()) {
+                results.push_back(node.handle);
+            }
+        }
+    }
+
+    /**
+     * @brief Sets an object's position relative to its parent.
+     */
+    void SceneGraph::setLocalPosition(GameObjectHandle object, const sf::Vector2f& position) {
+        const std::uint32_t nodeIndex = findNode(object);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            GameObjectManager::getInstance().setObjectPosition(object, position);
+            return;
+        }
+
+        Node& node = nodes[nodeIndex];
+        node.localX = position.x;
+        node.localY = position.y;
+        node.dirty = true;
+    }
+
+    /**
+     * @brief Gets an object's position relative to its parent.
+     */
+    sf::Vector2f SceneGraph::getLocalPosition(GameObjectHandle object) const {
+        const std::uint32_t nodeIndex = findNode(object);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            const GameObjectManager& manager = GameObjectManager::getInstance();
+            const std::uint32_t denseIndex = manager.getDenseIndex(object);
+            return sf::Vector2f(manager.getTransforms().positionX[denseIndex], manager.getTransforms().positionY[denseIndex]);
+        }
+        return sf::Vector2f(nodes[nodeIndex].localX, nodes[nodeIndex].localY);
+    }
+
+    /**
+     * @brief Sets an object's rotation relative to its parent.
+     */
+    void SceneGraph::setLocalRotation(GameObjectHandle object, const sf::Angle& rotation) {
+        const std::uint32_t nodeIndex = findNode(object);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            GameObjectManager::getInstance().resolve(object)->setRotation(rotation);
+            return;
+        }
+
+        nodes[nodeIndex].localRotation = rotation.asRadians();
+        nodes[nodeIndex].dirty = true;
+    }
+
+    /**
+     * @brief Gets an object's rotation relative to its parent.
+     */
+    sf::Angle SceneGraph::getLocalRotation(GameObjectHandle object) const {
+        const std::uint32_t nodeIndex = findNode(object);
+        if (nodeIndex == NoNode || nodes[nodeIndex].parent == NoNode) {
+            const GameObjectManager& manager = GameObjectManager::getInstance();
+            return sf::radians(manager.getTransforms().rotation[manager.getDenseIndex(object)]);
+        }
+        return sf::radians(nodes[nodeIndex].localRotation);
+    }
+
+    /**
+     * @brief Drops nodes of destroyed objects, orphaning their children.
+     *
+     * Dead nodes are marked with a null handle and removed by the layout rebuild. Their
+     * children become roots at their last world transform.
+     * @return True if any node was dropped.
+     */
+    bool SceneGraph::removeDeadNodes() {
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        bool removed = false;
+
+        for (Node& node : nodes) {
+            if (!manager.isValid(node.handle)) {
+                if (nodeBySlot[node.handle.index] != NoNode && nodes[nodeBySlot[node.handle.index]].handle == node.handle) {
+                    nodeBySlot[node.handle.index] = NoNode;
+                }
+                node.handle = GameObjectHandle();
+                removed = true;
+            }
+        }
+        if (!removed) {
+            return false;
+        }
+
+        for (Node& node : nodes) {
+            if (node.parent != NoNode && nodes[node.parent].handle.isNull()) {
+                node.parent = NoNode;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reorders the nodes into per-tree breadth-first layout, dropping lone nodes.
+     *
+     * Each tree is written contiguously, root first, and each node's children are appended
+     * together when the node is reached, so they end up adjacent.
+     */
+    void SceneGraph::rebuildLayout() {
+        const std::uint32_t count = static_cast<std::uint32_t>(nodes.size());
+
+        // Children of each node in compressed form: childList[childOffsets[i] .. childOffsets[i + 1])
+        std::vector<std::uint32_t> childOffsets(count + 1, 0);
+        for (const Node& node : nodes) {
+            if (!node.handle.isNull() && node.parent != NoNode) {
+                ++childOffsets[node.parent + 1];
+            }
+        }
+        for (std::uint32_t i = 0; i < count; ++i) {
+            childOffsets[i + 1] += childOffsets[i];
+        }
+        std::vector<std::uint32_t> childList(childOffsets[count]);
+        std::vector<std::uint32_t> fill(childOffsets.begin(), childOffsets.end() - 1);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (!nodes[i].handle.isNull() && nodes[i].parent != NoNode) {
+                childList[fill[nodes[i].parent]++] = i;
+            }
+        }
+
+        std::vector<Node> ordered;
+        ordered.reserve(count);
+        treeStarts.clear();
+
+        // Breadth-first walk of each tree; `order` doubles as the queue
+        std::vector<std::uint32_t> order;
+        order.reserve(count);
+        for (std::uint32_t root = 0; root < count; ++root) {
+            const Node& rootNode = nodes[root];
+            if (rootNode.handle.isNull() || rootNode.parent != NoNode || childOffsets[root] == childOffsets[root + 1]) {
+                continue;
+            }
+
+            treeStarts.push_back(static_cast<std::uint32_t>(ordered.size()));
+            const std::size_t treeBegin = order.size();
+            order.push_back(root);
+            ordered.push_back(rootNode);
+            ordered.back().parent = NoNode;
+
+            for (std::size_t head = treeBegin; head < order.size(); ++head) {
+                const std::uint32_t oldIndex = order[head];
+                const std::uint32_t newIndex = static_cast<std::uint32_t>(head);
+                ordered[newIndex].firstChild = static_cast<std::uint32_t>(ordered.size());
+                ordered[newIndex].childCount = childOffsets[oldIndex + 1] - childOffsets[oldIndex];
+
+                for (std::uint32_t c = childOffsets[oldIndex]; c < childOffsets[oldIndex + 1]; ++c) {
+                    order.push_back(childList[c]);
+                    ordered.push_back(nodes[childList[c]]);
+                    ordered.back().parent = newIndex;
+                }
+            }
+        }
+
+        for (const Node& node : nodes) {
+            if (!node.handle.isNull()) {
+                nodeBySlot[node.handle.index] = NoNode;
+            }
+        }
+        for (std::uint32_t i = 0; i < ordered.size(); ++i) {
+            nodeBySlot[ordered[i].handle.index] = i;
+        }
+
+        nodes.swap(ordered);
+        structureDirty = false;
+    }
+
+    /**
+     * @brief Recomputes the world transforms of one tree.
+     *
+     * The root's world transform is read from the TransformStore. A node is recomputed when
+     * its local transform changed or its parent moved during this pass, which is known by the
+     * time the node is reached because parents precede children.
+     * @param begin Index of the tree's root.
+     * @param end One past the tree's last node.
+     */
+    void SceneGraph::updateTree(std::size_t begin, std::size_t end) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        TransformStore& transforms = manager.getTransforms();
+
+        Node& root = nodes[begin];
+        const std::uint32_t rootDense = manager.getDenseIndex(root.handle);
+        const float rootX = transforms.positionX[rootDense];
+        const float rootY = transforms.positionY[rootDense];
+        const float rootRotation = transforms.rotation[rootDense];
+        if (root.dirty || rootX != root.worldX || rootY != root.worldY || rootRotation != root.worldRotation) {
+            root.worldX = rootX;
+            root.worldY = rootY;
+            if (rootRotation != root.worldRotation) {
+                root.worldRotation = rootRotation;
+                root.worldCos = std::cos(rootRotation);
+                root.worldSin = std::sin(rootRotation);
+            }
+            root.movedPass = pass;
+            root.dirty = false;
+        }
+
+        for (std::size_t i = begin + 1; i < end; ++i) {
+            Node& node = nodes[i];
+            const Node& parent = nodes[node.parent];
+            if (!node.dirty && parent.movedPass != pass) {
+                continue;
+            }
+
+            node.worldX = parent.worldX + node.localX * parent.worldCos - node.localY * parent.worldSin;
+            node.worldY = parent.worldY + node.localX * parent.worldSin + node.localY * parent.worldCos;
+            node.worldRotation = parent.worldRotation + node.localRotation;
+            node.worldCos = std::cos(node.worldRotation);
+            node.worldSin = std::sin(node.worldRotation);
+            node.movedPass = pass;
+            node.dirty = false;
+
+            const std::uint32_t denseIndex = manager.getDenseIndex(node.handle);
+            transforms.positionX[denseIndex] = node.worldX;
+            transforms.positionY[denseIndex] = node.worldY;
+            transforms.rotation[denseIndex] = node.worldRotation;
+        }
+    }
+
+    /**
+     * @brief Recomputes world transforms for every subtree that changed.
+     *
+     * Each tree writes only its own objects' TransformStore entries, so trees run in parallel.
+     * Moved children are marked as changed and synced into the spatial index afterwards, on
+     * the calling thread.
+     */
+    void SceneGraph::update() {
+        const bool removed = removeDeadNodes();
+        if (structureDirty || removed) {
+            rebuildLayout();
+        }
+        if (nodes.empty()) {
+            return;
+        }
+
+        ++pass;
+        const auto treeEnd = [this](std::size_t tree) {
+            return tree + 1 < treeStarts.size() ? treeStarts[tree + 1] : nodes.size();
+            };
+        const auto updateTrees = [&](std::size_t first, std::size_t last) {
+            for (std::size_t tree = first; tree < last; ++tree) {
+                updateTree(treeStarts[tree], treeEnd(tree));
+            }
+            };
+
+        if (nodes.size() < ParallelNodeThreshold) {
+            updateTrees(0, treeStarts.size());
+        }
+        else {
+            JobSystem& jobSystem = JobSystem::getInstance();
+            const std::size_t chunkSize = std::max<std::size_t>(1, treeStarts.size() / (jobSystem.getThreadCount() * 4));
+            jobSystem.parallelFor(treeStarts.size(), chunkSize, updateTrees);
+        }
+
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        SpatialIndex* spatialIndex = manager.getSpatialIndex();
+        for (const Node& node : nodes) {
+            if (node.parent != NoNode && node.movedPass == pass) {
+                manager.markChanged(node.handle, ChangeFlags::Position | ChangeFlags::Rotation);
+                if (spatialIndex) {
+                    spatialIndex->update(node.handle, sf::Vector2f(node.worldX, node.worldY));
+                }
+            }
+        }
+    }
+
+} // namespace KryptosEngine
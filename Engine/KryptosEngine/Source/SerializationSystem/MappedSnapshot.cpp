@@ -0,0 +1,214 @@
+/*
+ * MappedSnapshot.cpp - Kryptos Memory-Mapped World Snapshot Implementation
+ * ------------------------------------------------------------------------
+ * Implements platform file mapping and snapshot validation for the
+ * MappedSnapshot class.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - MappedSnapshot.h: Header for the MappedSnapshot class.
+ *   - windows.h (Windows) or sys/mman.h (POSIX): For mapping the file.
+ *   - stdexcept: For reporting unreadable or malformed snapshots.
+ */
+
+#include "../Include/SerializationSystem/MappedSnapshot.h"
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace KryptosEngine {
+
+    /**
+     * @brief Maps a snapshot file read-only and validates it.
+     * @param path Path of the file to map.
+     * @throw std::runtime_error if the file cannot be mapped or is not a valid snapshot.
+     */
+    MappedSnapshot::MappedSnapshot(const std::string& path) {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            file = nullptr;
+            throw std::runtime_error("Failed to open snapshot: " + path);
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SnapshotHeader))) {
+            release();
+            throw std::runtime_error("Snapshot is too small: " + path);
+        }
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (view == nullptr) {
+            release();
+            throw std::runtime_error("Failed to map snapshot: " + path);
+        }
+        data = static_cast<const std::byte*>(view);
+#else
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("Failed to open snapshot: " + path);
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(SnapshotHeader))) {
+            close(descriptor);
+            throw std::runtime_error("Snapshot is too small: " + path);
+        }
+        size = static_cast<std::size_t>(status.st_size);
+
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (view == MAP_FAILED) {
+            size = 0;
+            throw std::runtime_error("Failed to map snapshot: " + path);
+        }
+        data = static_cast<const std::byte*>(view);
+#endif
+
+        try {
+            validate();
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Unmaps the file.
+     */
+    MappedSnapshot::~MappedSnapshot() {
+        release();
+    }
+
+    MappedSnapshot::MappedSnapshot(MappedSnapshot&& other) noexcept
+        : data(std::exchange(other.data, nullptr)),
+        size(std::exchange(other.size, 0))
+#ifdef _WIN32
+        , file(std::exchange(other.file, nullptr)),
+        mapping(std::exchange(other.mapping, nullptr))
+#endif
+    {
+    }
+
+    MappedSnapshot& MappedSnapshot::operator=(MappedSnapshot&& other) noexcept {
+        if (this != &other) {
+            release();
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+#ifdef _WIN32
+            file = std::exchange(other.file, nullptr);
+            mapping = std::exchange(other.mapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Unmaps the file and closes it.
+     */
+    void MappedSnapshot::release() {
+#ifdef _WIN32
+        if (data) {
+            UnmapViewOfFile(data);
+        }
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        if (file) {
+            CloseHandle(file);
+        }
+        file = nullptr;
+        mapping = nullptr;
+#else
+        if (data) {
+            munmap(const_cast<std::byte*>(data), size);
+        }
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+    /**
+     * @brief Checks the header and that every section lies inside the file.
+     *
+     * After this, every getter can index its arrays without further checks. The only
+     * per-object pass is over the name indices, so getName can never read out of bounds.
+     * @throw std::runtime_error if the snapshot is malformed or from another version.
+     */
+    void MappedSnapshot::validate() const {
+        const SnapshotHeader& header = getHeader();
+        if (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0) {
+            throw std::runtime_error("Not a world snapshot");
+        }
+        if (header.byteOrder != SnapshotByteOrder) {
+            throw std::runtime_error("World snapshot was saved with a different byte order");
+        }
+        if (header.version != SnapshotVersion) {
+            throw std::runtime_error("Unsupported world snapshot version " + std::to_string(header.version));
+        }
+        if (header.fileSize != size) {
+            throw std::runtime_error("World snapshot is truncated");
+        }
+
+        // Every array holds at least one byte per entry, so larger counts cannot fit
+        if (header.objectCount > size || header.nameCount >= size || header.activeCount > header.objectCount) {
+            throw std::runtime_error("World snapshot has invalid counts");
+        }
+
+        const auto checkSection = [this](std::uint64_t offset, std::uint64_t bytes) {
+            if (offset % SnapshotSectionAlignment != 0 || offset > size || bytes > size - offset) {
+                throw std::runtime_error("World snapshot section is out of bounds");
+            }
+            };
+
+        const std::uint64_t objects = header.objectCount;
+        checkSection(header.nameOffsets, (header.nameCount + 1) * sizeof(std::uint32_t));
+        checkSection(header.nameIndices, objects * sizeof(std::uint32_t));
+        checkSection(header.handleIndices, objects * sizeof(std::uint32_t));
+        checkSection(header.handleGenerations, objects * sizeof(std::uint32_t));
+        checkSection(header.positionX, objects * sizeof(float));
+        checkSection(header.positionY, objects * sizeof(float));
+        checkSection(header.rotation, objects * sizeof(float));
+        checkSection(header.velocityX, objects * sizeof(float));
+        checkSection(header.velocityY, objects * sizeof(float));
+        checkSection(header.mass, objects * sizeof(float));
+        checkSection(header.useGravity, objects * sizeof(std::uint8_t));
+
+        const std::uint32_t* offsets = section<std::uint32_t>(header.nameOffsets);
+        for (std::uint64_t i = 0; i < header.nameCount; ++i) {
+            if (offsets[i] > offsets[i + 1]) {
+                throw std::runtime_error("World snapshot name table is corrupt");
+            }
+        }
+        checkSection(header.nameData, offsets[header.nameCount]);
+
+        const std::uint32_t* nameIndices = section<std::uint32_t>(header.nameIndices);
+        for (std::uint64_t i = 0; i < objects; ++i) {
+            if (nameIndices[i] >= header.nameCount) {
+                throw std::runtime_error("World snapshot name index is out of range");
+            }
+        }
+    }
+
+} // namespace KryptosEngine
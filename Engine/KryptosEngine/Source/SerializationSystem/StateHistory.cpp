@@ -0,0 +1,186 @@
+/*
+ * StateHistory.cpp - Kryptos Frame History Implementation
+ * -------------------------------------------------------
+ * Implements delta capture, frame eviction and rewind for the StateHistory
+ * class.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - StateHistory.h: Header for the StateHistory class.
+ *   - stdexcept: For rejecting empty buffers.
+ */
+
+#include "../Include/SerializationSystem/StateHistory.h"
+#include <stdexcept>
+
+namespace KryptosEngine {
+
+    /**
+     * @brief Creates a history and takes the current world as its baseline.
+     * @param frameCapacity Maximum number of frames kept.
+     * @param recordCapacity Maximum number of changed-object records kept across all frames.
+     * @throw std::invalid_argument if either capacity is zero.
+     */
+    StateHistory::StateHistory(std::size_t frameCapacity, std::size_t recordCapacity) {
+        if (frameCapacity == 0 || recordCapacity == 0) {
+            throw std::invalid_argument("StateHistory capacities must be greater than zero");
+        }
+        frames.resize(frameCapacity);
+        records.resize(recordCapacity);
+        replaySteps.reserve(frameCapacity);
+        reset();
+    }
+
+    /**
+     * @brief Reads an object's current state.
+     */
+    StateHistory::ObjectState StateHistory::readState(GameObjectHandle handle) {
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        const TransformStore& transforms = manager.getTransforms();
+        const std::uint32_t i = manager.getDenseIndex(handle);
+        return { transforms.positionX[i], transforms.positionY[i], transforms.rotation[i],
+            transforms.velocityX[i], transforms.velocityY[i], transforms.mass[i],
+            transforms.useGravity[i], static_cast<std::uint8_t>(manager.isObjectActive(handle) ? 1 : 0) };
+    }
+
+    /**
+     * @brief Applies a state to a live object through its setters.
+     *
+     * The setters keep the spatial index and change tracking in sync.
+     */
+    void StateHistory::applyState(GameObjectHandle handle, const ObjectState& state) {
+        GameObject* object = GameObjectManager::getInstance().resolve(handle);
+        object->setPosition(sf::Vector2f(state.positionX, state.positionY));
+        object->setRotation(sf::radians(state.rotation));
+        object->setVelocity(sf::Vector2f(state.velocityX, state.velocityY));
+        object->setMass(state.mass);
+        object->setUseGravity(state.useGravity != 0);
+        object->setActive(state.active != 0);
+    }
+
+    /**
+     * @brief Stores an object's current state as its shadow.
+     *
+     * The shadow only grows when the registry has grown.
+     */
+    void StateHistory::updateShadow(GameObjectHandle handle, const ObjectState& state) {
+        if (handle.index >= shadowHandles.size()) {
+            shadowHandles.resize(handle.index + 1);
+            shadowStates.resize(handle.index + 1);
+        }
+        shadowHandles[handle.index] = handle;
+        shadowStates[handle.index] = state;
+    }
+
+    /**
+     * @brief Drops the oldest buffered frame.
+     */
+    void StateHistory::dropOldestFrame() {
+        const Frame& frame = frameAt(0);
+        oldestRecord = (oldestRecord + frame.recordCount) % records.size();
+        recordCount -= frame.recordCount;
+        oldestFrame = (oldestFrame + 1) % frames.size();
+        --frameCount;
+    }
+
+    /**
+     * @brief Forgets every buffered frame and takes the current world as the new baseline.
+     */
+    void StateHistory::reset() {
+        oldestFrame = 0;
+        frameCount = 0;
+        oldestRecord = 0;
+        recordCount = 0;
+
+        for (GameObject* object : GameObjectManager::getInstance().getGameObjects()) {
+            updateShadow(object->getHandle(), readState(object->getHandle()));
+        }
+    }
+
+    /**
+     * @brief Records the changes made during the current frame.
+     *
+     * Each changed object's shadow holds its state at the previous capture, which is exactly
+     * the "before" value the frame needs. Objects created during the frame have no earlier
+     * state and only get a shadow. Room is made before writing by dropping the oldest frames,
+     * using the change list's length as an upper bound on the frame's record count.
+     * @param deltaTime The frame's time step, kept for re-simulation.
+     */
+    void StateHistory::capture(float deltaTime) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        const std::vector<GameObjectHandle>& changed = manager.getChangedObjects();
+
+        const bool fits = changed.size() <= records.size();
+        if (!fits) {
+            oldestFrame = 0;
+            frameCount = 0;
+            oldestRecord = 0;
+            recordCount = 0;
+        }
+        while (frameCount > 0 && (frameCount == frames.size() || recordCount + changed.size() > records.size())) {
+            dropOldestFrame();
+        }
+
+        const std::size_t firstRecord = (oldestRecord + recordCount) % records.size();
+        std::size_t written = 0;
+        for (GameObjectHandle handle : changed) {
+            const ObjectState state = readState(handle);
+            if (fits && handle.index < shadowHandles.size() && shadowHandles[handle.index] == handle) {
+                records[(firstRecord + written) % records.size()] = { handle, shadowStates[handle.index] };
+                ++written;
+            }
+            updateShadow(handle, state);
+        }
+
+        recordCount += written;
+        frames[(oldestFrame + frameCount) % frames.size()] = { manager.getChangeFrame(), deltaTime, firstRecord, written };
+        ++frameCount;
+    }
+
+    /**
+     * @brief Rewinds the world to the state it had when a buffered frame was captured.
+     *
+     * First undoes uncaptured changes from the shadow, then walks the newer frames newest
+     * first, applying each record's "before" state and moving the shadow back with it.
+     * @param frameNumber A frame number between getOldestFrame and getNewestFrame.
+     * @return False if the frame is not buffered, in which case nothing changes.
+     */
+    bool StateHistory::restore(std::uint32_t frameNumber) {
+        std::size_t target = frameCount;
+        for (std::size_t age = 0; age < frameCount; ++age) {
+            if (frameAt(age).number == frameNumber) {
+                target = age;
+                break;
+            }
+        }
+        if (target == frameCount) {
+            return false;
+        }
+
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        const std::vector<GameObjectHandle>& changed = manager.getChangedObjects();
+        for (std::size_t i = 0; i < changed.size(); ++i) {
+            const GameObjectHandle handle = changed[i];
+            if (handle.index < shadowHandles.size() && shadowHandles[handle.index] == handle) {
+                applyState(handle, shadowStates[handle.index]);
+            }
+        }
+
+        while (frameCount > target + 1) {
+            const Frame& frame = frameAt(frameCount - 1);
+            for (std::size_t i = frame.recordCount; i-- > 0;) {
+                const Record& record = records[(frame.firstRecord + i) % records.size()];
+                if (manager.isValid(record.handle)) {
+                    applyState(record.handle, record.before);
+                    shadowStates[record.handle.index] = record.before;
+                }
+            }
+            recordCount -= frame.recordCount;
+            --frameCount;
+        }
+        return true;
+    }
+
+} // namespace KryptosEngine
@@ -0,0 +1,174 @@
+/*
+ * WorldSnapshot.cpp - Kryptos World Snapshots Implementation
+ * ----------------------------------------------------------
+ * Implements snapshot writing and checkpoint restore for the WorldSnapshot
+ * class.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - WorldSnapshot.h: Header for the WorldSnapshot class.
+ *   - GameObjectManager.h: Source of the object state.
+ *   - fstream: For writing the snapshot file.
+ *   - stdexcept: For reporting write failures.
+ */
+
+#include "../Include/SerializationSystem/WorldSnapshot.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * @brief Reserves a section at the end of the layout.
+         * @param end Current end of the layout; advanced past the section.
+         * @param bytes Size of the section.
+         * @return Offset of the section.
+         */
+        std::uint64_t reserveSection(std::uint64_t& end, std::uint64_t bytes) {
+            const std::uint64_t offset = (end + SnapshotSectionAlignment - 1) / SnapshotSectionAlignment * SnapshotSectionAlignment;
+            end = offset + bytes;
+            return offset;
+        }
+
+        /**
+         * @brief Copies a TransformStore column into its section.
+         */
+        template <typename T>
+        void copyColumn(std::vector<char>& buffer, std::uint64_t offset, const std::vector<T>& column) {
+            if (!column.empty()) {
+                std::memcpy(buffer.data() + offset, column.data(), column.size() * sizeof(T));
+            }
+        }
+    }
+
+    /**
+     * @brief Saves every registered game object to a snapshot file.
+     *
+     * The TransformStore columns are already packed in dense order, so each array is a
+     * single copy. Only the names in use are written, each once.
+     * @param path Path of the file to write; an existing file is replaced.
+     * @throw std::runtime_error if the file cannot be written.
+     */
+    void WorldSnapshot::save(const std::string& path) {
+        const GameObjectManager& manager = GameObjectManager::getInstance();
+        const std::vector<GameObject*>& objects = manager.getGameObjects();
+        const TransformStore& transforms = manager.getTransforms();
+        const NameTable& names = NameTable::getInstance();
+        const std::uint64_t count = objects.size();
+
+        // Number the names in use in order of first appearance
+        std::vector<std::uint32_t> snapshotName(names.size(), GameObjectHandle::InvalidIndex);
+        std::vector<NameId> usedNames;
+        std::vector<std::uint32_t> nameIndices(count);
+        std::uint32_t nameBytes = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const NameId nameId = objects[i]->getNameId();
+            if (snapshotName[nameId] == GameObjectHandle::InvalidIndex) {
+                snapshotName[nameId] = static_cast<std::uint32_t>(usedNames.size());
+                usedNames.push_back(nameId);
+                nameBytes += static_cast<std::uint32_t>(names.view(nameId).size());
+            }
+            nameIndices[i] = snapshotName[nameId];
+        }
+
+        SnapshotHeader header = {};
+        std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+        header.version = SnapshotVersion;
+        header.byteOrder = SnapshotByteOrder;
+        header.objectCount = count;
+        header.activeCount = manager.getActiveCount();
+        header.nameCount = usedNames.size();
+
+        std::uint64_t end = sizeof(SnapshotHeader);
+        header.nameOffsets = reserveSection(end, (usedNames.size() + 1) * sizeof(std::uint32_t));
+        header.nameData = reserveSection(end, nameBytes);
+        header.nameIndices = reserveSection(end, count * sizeof(std::uint32_t));
+        header.handleIndices = reserveSection(end, count * sizeof(std::uint32_t));
+        header.handleGenerations = reserveSection(end, count * sizeof(std::uint32_t));
+        header.positionX = reserveSection(end, count * sizeof(float));
+        header.positionY = reserveSection(end, count * sizeof(float));
+        header.rotation = reserveSection(end, count * sizeof(float));
+        header.velocityX = reserveSection(end, count * sizeof(float));
+        header.velocityY = reserveSection(end, count * sizeof(float));
+        header.mass = reserveSection(end, count * sizeof(float));
+        header.useGravity = reserveSection(end, count * sizeof(std::uint8_t));
+        header.fileSize = end;
+
+        std::vector<char> buffer(static_cast<std::size_t>(end), 0);
+        std::memcpy(buffer.data(), &header, sizeof(header));
+
+        // Name table
+        std::uint32_t* nameOffsets = reinterpret_cast<std::uint32_t*>(buffer.data() + header.nameOffsets);
+        std::uint32_t nameOffset = 0;
+        for (std::size_t n = 0; n < usedNames.size(); ++n) {
+            const std::string_view name = names.view(usedNames[n]);
+            nameOffsets[n] = nameOffset;
+            std::memcpy(buffer.data() + header.nameData + nameOffset, name.data(), name.size());
+            nameOffset += static_cast<std::uint32_t>(name.size());
+        }
+        nameOffsets[usedNames.size()] = nameOffset;
+
+        // Per-object arrays
+        copyColumn(buffer, header.nameIndices, nameIndices);
+        std::uint32_t* handleIndices = reinterpret_cast<std::uint32_t*>(buffer.data() + header.handleIndices);
+        std::uint32_t* handleGenerations = reinterpret_cast<std::uint32_t*>(buffer.data() + header.handleGenerations);
+        for (std::size_t i = 0; i < count; ++i) {
+            const GameObjectHandle handle = objects[i]->getHandle();
+            handleIndices[i] = handle.index;
+            handleGenerations[i] = handle.generation;
+        }
+        copyColumn(buffer, header.positionX, transforms.positionX);
+        copyColumn(buffer, header.positionY, transforms.positionY);
+        copyColumn(buffer, header.rotation, transforms.rotation);
+        copyColumn(buffer, header.velocityX, transforms.velocityX);
+        copyColumn(buffer, header.velocityY, transforms.velocityY);
+        copyColumn(buffer, header.mass, transforms.mass);
+        copyColumn(buffer, header.useGravity, transforms.useGravity);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            throw std::runtime_error("Failed to write snapshot: " + path);
+        }
+    }
+
+    /**
+     * @brief Restores saved state onto the objects that are still alive.
+     * @param snapshot A mapped snapshot.
+     * @return The number of objects restored.
+     */
+    std::size_t WorldSnapshot::restore(const MappedSnapshot& snapshot) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        const float* positionX = snapshot.getPositionX();
+        const float* positionY = snapshot.getPositionY();
+        const float* rotation = snapshot.getRotation();
+        const float* velocityX = snapshot.getVelocityX();
+        const float* velocityY = snapshot.getVelocityY();
+        const float* mass = snapshot.getMass();
+        const std::uint8_t* useGravity = snapshot.getUseGravity();
+
+        std::size_t restored = 0;
+        for (std::size_t i = 0; i < snapshot.getObjectCount(); ++i) {
+            GameObject* object = manager.resolve(snapshot.getHandle(i));
+            if (object == nullptr || object->getName() != snapshot.getName(i)) {
+                continue;
+            }
+
+            object->setPosition(sf::Vector2f(positionX[i], positionY[i]));
+            object->setRotation(sf::radians(rotation[i]));
+            object->setVelocity(sf::Vector2f(velocityX[i], velocityY[i]));
+            object->setMass(mass[i]);
+            object->setUseGravity(useGravity[i] != 0);
+            object->setActive(i < snapshot.getActiveCount());
+            ++restored;
+        }
+        return restored;
+    }
+
+} // namespace KryptosEngine
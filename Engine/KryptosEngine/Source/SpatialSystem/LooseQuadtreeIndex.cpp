@@ -0,0 +1,374 @@
+/*
+ * LooseQuadtreeIndex.cpp - Kryptos Loose Quadtree Implementation
+ * --------------------------------------------------------------
+ * Implements node management and queries for the LooseQuadtreeIndex.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - LooseQuadtreeIndex.h: Header for the LooseQuadtreeIndex class.
+ *   - algorithm, queue: For heap operations in nearest-neighbour queries.
+ *   - cmath: For distance calculations.
+ */
+
+#include "../Include/SpatialSystem/LooseQuadtreeIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Marks an entry that is not stored in any node, or a leaf's missing children.
+         */
+        constexpr std::uint32_t NoNode = GameObjectHandle::InvalidIndex;
+
+        /**
+         * Ratio between a node's loose bounds and its tight quadrant.
+         */
+        constexpr float Looseness = 2.f;
+
+        /**
+         * @brief Gets the child quadrant (0-3) of a node that a point falls into.
+         */
+        std::uint32_t quadrantOf(const sf::Vector2f& centre, const sf::Vector2f& point) {
+            return (point.x >= centre.x ? 1u : 0u) | (point.y >= centre.y ? 2u : 0u);
+        }
+    }
+
+    /**
+     * @brief Constructs an empty quadtree covering a world area.
+     * @param worldBounds The area covered by the root. It is extended to a square if necessary.
+     * @param maxDepth The deepest level a node may be split to.
+     * @param nodeCapacity The object count above which a leaf is split.
+     */
+    LooseQuadtreeIndex::LooseQuadtreeIndex(const sf::FloatRect& worldBounds, std::uint32_t maxDepth, std::size_t nodeCapacity)
+        : maxDepth(maxDepth),
+        nodeCapacity(nodeCapacity),
+        objectCount(0) {
+        const sf::Vector2f centre = worldBounds.position + worldBounds.size * 0.5f;
+        const float halfSize = std::max(worldBounds.size.x, worldBounds.size.y) * 0.5f;
+        nodes.push_back({ centre, halfSize, 0, NoNode, {} });
+    }
+
+    /**
+     * @brief Gets the half-size of a node's loose bounds.
+     */
+    float LooseQuadtreeIndex::looseHalfSize(const Node& node) {
+        return node.halfSize * Looseness;
+    }
+
+    /**
+     * @brief Checks whether a point lies within a node's loose bounds.
+     */
+    bool LooseQuadtreeIndex::looseContains(const Node& node, const sf::Vector2f& point) {
+        const float half = looseHalfSize(node);
+        return point.x >= node.centre.x - half && point.x <= node.centre.x + half &&
+            point.y >= node.centre.y - half && point.y <= node.centre.y + half;
+    }
+
+    /**
+     * @brief Gets the squared distance from a point to a node's loose bounds.
+     */
+    float LooseQuadtreeIndex::looseDistanceSquared(const Node& node, const sf::Vector2f& point) {
+        const float half = looseHalfSize(node);
+        const float dx = std::max(std::abs(point.x - node.centre.x) - half, 0.f);
+        const float dy = std::max(std::abs(point.y - node.centre.y) - half, 0.f);
+        return dx * dx + dy * dy;
+    }
+
+    /**
+     * @brief Finds the deepest existing node that should hold a point.
+     *
+     * Descends while the child quadrant containing the point also loosely contains it.
+     * @return Index of the node.
+     */
+    std::uint32_t LooseQuadtreeIndex::findNode(const sf::Vector2f& point) const {
+        std::uint32_t nodeIndex = 0;
+        while (nodes[nodeIndex].firstChild != NoNode) {
+            const Node& node = nodes[nodeIndex];
+            const std::uint32_t child = node.firstChild + quadrantOf(node.centre, point);
+            if (!looseContains(nodes[child], point)) {
+                break;
+            }
+            nodeIndex = child;
+        }
+        return nodeIndex;
+    }
+
+    /**
+     * @brief Stores an object in a node, splitting the node if it overflows.
+     * @param slot The object's slot index.
+     * @param nodeIndex The node to store the object in.
+     */
+    void LooseQuadtreeIndex::link(std::uint32_t slot, std::uint32_t nodeIndex) {
+        Node& node = nodes[nodeIndex];
+        Entry& entry = entries[slot];
+        entry.node = nodeIndex;
+        entry.nodeIndex = static_cast<std::uint32_t>(node.slots.size());
+        node.slots.push_back(slot);
+
+        if (node.firstChild == NoNode && node.slots.size() > nodeCapacity && node.depth < maxDepth) {
+            split(nodeIndex);
+        }
+    }
+
+    /**
+     * @brief Removes an object from its node.
+     * @param slot The object's slot index.
+     */
+    void LooseQuadtreeIndex::unlink(std::uint32_t slot) {
+        Entry& entry = entries[slot];
+        Node& node = nodes[entry.node];
+
+        const std::uint32_t moved = node.slots.back();
+        node.slots[entry.nodeIndex] = moved;
+        entries[moved].nodeIndex = entry.nodeIndex;
+        node.slots.pop_back();
+
+        entry.node = NoNode;
+    }
+
+    /**
+     * @brief Creates four children for a leaf and moves its objects into them where they fit.
+     *
+     * Objects that do not lie within the loose bounds of their child quadrant stay in the node.
+     * @param nodeIndex The leaf to split.
+     */
+    void LooseQuadtreeIndex::split(std::uint32_t nodeIndex) {
+        const std::uint32_t firstChild = static_cast<std::uint32_t>(nodes.size());
+        const sf::Vector2f centre = nodes[nodeIndex].centre;
+        const float childHalf = nodes[nodeIndex].halfSize * 0.5f;
+        const std::uint32_t childDepth = nodes[nodeIndex].depth + 1;
+
+        for (std::uint32_t quadrant = 0; quadrant < 4; ++quadrant) {
+            const sf::Vector2f offset((quadrant & 1u) ? childHalf : -childHalf, (quadrant & 2u) ? childHalf : -childHalf);
+            nodes.push_back({ centre + offset, childHalf, childDepth, NoNode, {} });
+        }
+        nodes[nodeIndex].firstChild = firstChild;
+
+        std::vector<std::uint32_t> remaining;
+        for (std::uint32_t slot : nodes[nodeIndex].slots) {
+            const std::uint32_t child = firstChild + quadrantOf(centre, entries[slot].position);
+            if (looseContains(nodes[child], entries[slot].position)) {
+                Node& target = nodes[child];
+                entries[slot].node = child;
+                entries[slot].nodeIndex = static_cast<std::uint32_t>(target.slots.size());
+                target.slots.push_back(slot);
+            }
+            else {
+                entries[slot].nodeIndex = static_cast<std::uint32_t>(remaining.size());
+                remaining.push_back(slot);
+            }
+        }
+        nodes[nodeIndex].slots.swap(remaining);
+    }
+
+    /**
+     * @brief Adds an object to the quadtree.
+     * @param handle The object's handle.
+     * @param position The object's position.
+     */
+    void LooseQuadtreeIndex::insert(GameObjectHandle handle, const sf::Vector2f& position) {
+        if (handle.index >= entries.size()) {
+            entries.resize(handle.index + 1, { sf::Vector2f(), 0, NoNode, 0 });
+        }
+
+        Entry& entry = entries[handle.index];
+        if (entry.node != NoNode) {
+            unlink(handle.index);
+            --objectCount;
+        }
+
+        entry.position = position;
+        entry.generation = handle.generation;
+        link(handle.index, findNode(position));
+        ++objectCount;
+    }
+
+    /**
+     * @brief Moves an object within the quadtree.
+     *
+     * The object stays in its node while it remains inside the node's loose bounds and
+     * cannot descend into a child; otherwise it is relinked.
+     * @param handle The object's handle.
+     * @param position The object's new position.
+     */
+    void LooseQuadtreeIndex::update(GameObjectHandle handle, const sf::Vector2f& position) {
+        if (handle.index >= entries.size() || entries[handle.index].node == NoNode) {
+            insert(handle, position);
+            return;
+        }
+
+        Entry& entry = entries[handle.index];
+        entry.position = position;
+        entry.generation = handle.generation;
+
+        const Node& node = nodes[entry.node];
+        if (entry.node != 0 && looseContains(node, position)) {
+            if (node.firstChild == NoNode) {
+                return;
+            }
+            const Node& child = nodes[node.firstChild + quadrantOf(node.centre, position)];
+            if (!looseContains(child, position)) {
+                return;
+            }
+        }
+
+        const std::uint32_t target = findNode(position);
+        if (target != entry.node) {
+            unlink(handle.index);
+            link(handle.index, target);
+        }
+    }
+
+    /**
+     * @brief Removes an object from the quadtree.
+     * @param handle The object's handle.
+     */
+    void LooseQuadtreeIndex::remove(GameObjectHandle handle) {
+        if (handle.index < entries.size() && entries[handle.index].node != NoNode) {
+            unlink(handle.index);
+            --objectCount;
+        }
+    }
+
+    /**
+     * @brief Removes every object from the quadtree, keeping only an empty root.
+     */
+    void LooseQuadtreeIndex::clear() {
+        entries.clear();
+        nodes.resize(1);
+        nodes[0].firstChild = NoNode;
+        nodes[0].slots.clear();
+        objectCount = 0;
+    }
+
+    /**
+     * @brief Finds every object inside an axis-aligned box.
+     *
+     * Visits only nodes whose loose bounds overlap the box. The root is always visited,
+     * since it holds objects outside the world bounds.
+     * @param area The box to search, in world coordinates.
+     * @param results Receives the handles of the objects found.
+     */
+    void LooseQuadtreeIndex::queryAABB(const sf::FloatRect& area, std::vector<GameObjectHandle>& results) const {
+        if (objectCount == 0) {
+            return;
+        }
+
+        const float left = area.position.x;
+        const float top = area.position.y;
+        const float right = left + area.size.x;
+        const float bottom = top + area.size.y;
+
+        std::vector<std::uint32_t> pending;
+        pending.reserve(4 * static_cast<std::size_t>(maxDepth) + 1);
+        pending.push_back(0);
+
+        while (!pending.empty()) {
+            const std::uint32_t nodeIndex = pending.back();
+            pending.pop_back();
+            const Node& node = nodes[nodeIndex];
+
+            for (std::uint32_t slot : node.slots) {
+                const Entry& entry = entries[slot];
+                if (entry.position.x >= left && entry.position.x <= right &&
+                    entry.position.y >= top && entry.position.y <= bottom) {
+                    results.push_back({ slot, entry.generation });
+                }
+            }
+
+            if (node.firstChild == NoNode) {
+                continue;
+            }
+            for (std::uint32_t child = node.firstChild; child < node.firstChild + 4; ++child) {
+                const Node& childNode = nodes[child];
+                const float half = looseHalfSize(childNode);
+                if (childNode.centre.x + half < left || childNode.centre.x - half > right ||
+                    childNode.centre.y + half < top || childNode.centre.y - half > bottom) {
+                    continue;
+                }
+                pending.push_back(child);
+            }
+        }
+    }
+
+    /**
+     * @brief Finds every object within a distance of a point.
+     * @param centre The centre of the search circle.
+     * @param radius The search radius.
+     * @param results Receives the handles of the objects found.
+     */
+    void LooseQuadtreeIndex::queryRadius(const sf::Vector2f& centre, float radius, std::vector<GameObjectHandle>& results) const {
+        const std::size_t first = results.size();
+        queryAABB(sf::FloatRect(centre - sf::Vector2f(radius, radius), sf::Vector2f(radius * 2.f, radius * 2.f)), results);
+
+        const float radiusSquared = radius * radius;
+        const auto outside = std::remove_if(results.begin() + first, results.end(), [&](const GameObjectHandle& handle) {
+            const sf::Vector2f offset = entries[handle.index].position - centre;
+            return offset.x * offset.x + offset.y * offset.y > radiusSquared;
+            });
+        results.erase(outside, results.end());
+    }
+
+    /**
+     * @brief Finds the objects closest to a point.
+     *
+     * Visits nodes in order of distance to their loose bounds and stops once the nearest
+     * unvisited node is further away than the furthest candidate kept.
+     * @param point The point to search from.
+     * @param count The maximum number of objects to return.
+     * @param results Receives the handles found, closest first.
+     */
+    void LooseQuadtreeIndex::queryNearest(const sf::Vector2f& point, std::size_t count, std::vector<GameObjectHandle>& results) const {
+        if (count == 0 || objectCount == 0) {
+            return;
+        }
+
+        using Candidate = std::pair<float, std::uint32_t>;
+        std::vector<Candidate> best;
+        best.reserve(std::min(count, objectCount));
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> frontier;
+        frontier.emplace(0.f, 0);
+
+        while (!frontier.empty()) {
+            const auto [nodeDistance, nodeIndex] = frontier.top();
+            frontier.pop();
+            if (best.size() == count && nodeDistance > best.front().first) {
+                break;
+            }
+
+            const Node& node = nodes[nodeIndex];
+            for (std::uint32_t slot : node.slots) {
+                const sf::Vector2f offset = entries[slot].position - point;
+                const float distanceSquared = offset.x * offset.x + offset.y * offset.y;
+                if (best.size() < count) {
+                    best.emplace_back(distanceSquared, slot);
+                    std::push_heap(best.begin(), best.end());
+                }
+                else if (distanceSquared < best.front().first) {
+                    std::pop_heap(best.begin(), best.end());
+                    best.back() = Candidate(distanceSquared, slot);
+                    std::push_heap(best.begin(), best.end());
+                }
+            }
+
+            if (node.firstChild != NoNode) {
+                for (std::uint32_t child = node.firstChild; child < node.firstChild + 4; ++child) {
+                    frontier.emplace(looseDistanceSquared(nodes[child], point), child);
+                }
+            }
+        }
+
+        std::sort_heap(best.begin(), best.end());
+        for (const Candidate& candidate : best) {
+            results.push_back({ candidate.second, entries[candidate.second].generation });
+        }
+    }
+
+} // namespace KryptosEngine
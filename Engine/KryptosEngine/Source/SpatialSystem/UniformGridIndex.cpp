@@ -0,0 +1,357 @@
+/*
+ * UniformGridIndex.cpp - Kryptos Uniform Hash Grid Implementation
+ * ---------------------------------------------------------------
+ * Implements cell bookkeeping and queries for the UniformGridIndex.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - UniformGridIndex.h: Header for the UniformGridIndex class.
+ *   - algorithm, cmath: For heap operations and cell coordinate rounding.
+ */
+
+#include "../Include/SpatialSystem/UniformGridIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace KryptosEngine {
+
+    namespace {
+        /**
+         * Marks an entry that is not linked into any cell.
+         */
+        constexpr std::uint32_t NoCell = GameObjectHandle::InvalidIndex;
+
+        /**
+         * Candidate for a nearest-neighbour query: squared distance and slot index.
+         */
+        using Candidate = std::pair<float, std::uint32_t>;
+
+        /**
+         * @brief Offers a candidate to a bounded max-heap of the closest objects found so far.
+         */
+        void offerCandidate(std::vector<Candidate>& heap, std::size_t count, float distanceSquared, std::uint32_t slot) {
+            if (heap.size() < count) {
+                heap.emplace_back(distanceSquared, slot);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (distanceSquared < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = Candidate(distanceSquared, slot);
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+    }
+
+    /**
+     * @brief Constructs an empty grid.
+     * @param cellSize Side length of a cell, in world units. Must be positive.
+     */
+    UniformGridIndex::UniformGridIndex(float cellSize)
+        : cellSize(cellSize),
+        inverseCellSize(1.f / cellSize),
+        objectCount(0),
+        minCellX(0), minCellY(0), maxCellX(-1), maxCellY(-1) {
+    }
+
+    /**
+     * @brief Packs cell coordinates into a hash key.
+     */
+    std::uint64_t UniformGridIndex::cellKey(std::int32_t x, std::int32_t y) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+    }
+
+    /**
+     * @brief Gets the cell coordinate of a world coordinate.
+     */
+    std::int32_t UniformGridIndex::toCell(float value) const {
+        return static_cast<std::int32_t>(std::floor(value * inverseCellSize));
+    }
+
+    /**
+     * @brief Finds or creates the cell at the given coordinates.
+     * @return Index of the cell.
+     */
+    std::uint32_t UniformGridIndex::acquireCell(std::int32_t x, std::int32_t y) {
+        const std::uint64_t key = cellKey(x, y);
+        const auto it = cellLookup.find(key);
+        if (it != cellLookup.end()) {
+            return it->second;
+        }
+
+        std::uint32_t cellIndex;
+        if (!freeCells.empty()) {
+            cellIndex = freeCells.back();
+            freeCells.pop_back();
+            cells[cellIndex].x = x;
+            cells[cellIndex].y = y;
+        }
+        else {
+            cellIndex = static_cast<std::uint32_t>(cells.size());
+            cells.push_back({ x, y, {} });
+        }
+        cellLookup.emplace(key, cellIndex);
+
+        if (maxCellX < minCellX) {
+            minCellX = maxCellX = x;
+            minCellY = maxCellY = y;
+        }
+        else {
+            minCellX = std::min(minCellX, x);
+            maxCellX = std::max(maxCellX, x);
+            minCellY = std::min(minCellY, y);
+            maxCellY = std::max(maxCellY, y);
+        }
+        return cellIndex;
+    }
+
+    /**
+     * @brief Links an object into the cell containing its position.
+     * @param slot The object's slot index.
+     */
+    void UniformGridIndex::link(std::uint32_t slot) {
+        Entry& entry = entries[slot];
+        const std::uint32_t cellIndex = acquireCell(toCell(entry.position.x), toCell(entry.position.y));
+        Cell& cell = cells[cellIndex];
+        entry.cell = cellIndex;
+        entry.cellIndex = static_cast<std::uint32_t>(cell.slots.size());
+        cell.slots.push_back(slot);
+    }
+
+    /**
+     * @brief Unlinks an object from its cell, recycling the cell if it becomes empty.
+     * @param slot The object's slot index.
+     */
+    void UniformGridIndex::unlink(std::uint32_t slot) {
+        Entry& entry = entries[slot];
+        Cell& cell = cells[entry.cell];
+
+        const std::uint32_t moved = cell.slots.back();
+        cell.slots[entry.cellIndex] = moved;
+        entries[moved].cellIndex = entry.cellIndex;
+        cell.slots.pop_back();
+
+        if (cell.slots.empty()) {
+            cellLookup.erase(cellKey(cell.x, cell.y));
+            freeCells.push_back(entry.cell);
+        }
+        entry.cell = NoCell;
+    }
+
+    /**
+     * @brief Finds a cell by coordinates without creating it.
+     * @return Pointer to the cell, or nullptr if it is not occupied.
+     */
+    const UniformGridIndex::Cell* UniformGridIndex::findCell(std::int32_t x, std::int32_t y) const {
+        const auto it = cellLookup.find(cellKey(x, y));
+        return it != cellLookup.end() ? &cells[it->second] : nullptr;
+    }
+
+    /**
+     * @brief Adds an object to the grid.
+     * @param handle The object's handle.
+     * @param position The object's position.
+     */
+    void UniformGridIndex::insert(GameObjectHandle handle, const sf::Vector2f& position) {
+        if (handle.index >= entries.size()) {
+            entries.resize(handle.index + 1, { sf::Vector2f(), 0, NoCell, 0 });
+        }
+
+        Entry& entry = entries[handle.index];
+        if (entry.cell != NoCell) {
+            unlink(handle.index);
+            --objectCount;
+        }
+
+        entry.position = position;
+        entry.generation = handle.generation;
+        link(handle.index);
+        ++objectCount;
+    }
+
+    /**
+     * @brief Moves an object within the grid.
+     *
+     * The object is only relinked when it crosses into a different cell.
+     * @param handle The object's handle.
+     * @param position The object's new position.
+     */
+    void UniformGridIndex::update(GameObjectHandle handle, const sf::Vector2f& position) {
+        if (handle.index >= entries.size() || entries[handle.index].cell == NoCell) {
+            insert(handle, position);
+            return;
+        }
+
+        Entry& entry = entries[handle.index];
+        const Cell& cell = cells[entry.cell];
+        entry.position = position;
+        entry.generation = handle.generation;
+
+        if (cell.x != toCell(position.x) || cell.y != toCell(position.y)) {
+            unlink(handle.index);
+            link(handle.index);
+        }
+    }
+
+    /**
+     * @brief Removes an object from the grid.
+     * @param handle The object's handle.
+     */
+    void UniformGridIndex::remove(GameObjectHandle handle) {
+        if (handle.index < entries.size() && entries[handle.index].cell != NoCell) {
+            unlink(handle.index);
+            --objectCount;
+        }
+    }
+
+    /**
+     * @brief Removes every object from the grid.
+     */
+    void UniformGridIndex::clear() {
+        entries.clear();
+        cells.clear();
+        freeCells.clear();
+        cellLookup.clear();
+        objectCount = 0;
+        minCellX = minCellY = 0;
+        maxCellX = maxCellY = -1;
+    }
+
+    /**
+     * @brief Finds every object inside an axis-aligned box.
+     *
+     * Visits the cells overlapping the box, or every occupied cell when that is fewer.
+     * @param area The box to search, in world coordinates.
+     * @param results Receives the handles of the objects found.
+     */
+    void UniformGridIndex::queryAABB(const sf::FloatRect& area, std::vector<GameObjectHandle>& results) const {
+        if (objectCount == 0) {
+            return;
+        }
+
+        const float left = area.position.x;
+        const float top = area.position.y;
+        const float right = left + area.size.x;
+        const float bottom = top + area.size.y;
+
+        const std::int32_t x0 = std::max(toCell(left), minCellX);
+        const std::int32_t y0 = std::max(toCell(top), minCellY);
+        const std::int32_t x1 = std::min(toCell(right), maxCellX);
+        const std::int32_t y1 = std::min(toCell(bottom), maxCellY);
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+
+        const auto collect = [&](const Cell& cell) {
+            for (std::uint32_t slot : cell.slots) {
+                const Entry& entry = entries[slot];
+                if (entry.position.x >= left && entry.position.x <= right &&
+                    entry.position.y >= top && entry.position.y <= bottom) {
+                    results.push_back({ slot, entry.generation });
+                }
+            }
+            };
+
+        const double rangeCells = (static_cast<double>(x1) - x0 + 1) * (static_cast<double>(y1) - y0 + 1);
+        if (rangeCells > static_cast<double>(cellLookup.size())) {
+            for (const auto& [key, cellIndex] : cellLookup) {
+                const Cell& cell = cells[cellIndex];
+                if (cell.x >= x0 && cell.x <= x1 && cell.y >= y0 && cell.y <= y1) {
+                    collect(cell);
+                }
+            }
+            return;
+        }
+
+        for (std::int32_t y = y0; y <= y1; ++y) {
+            for (std::int32_t x = x0; x <= x1; ++x) {
+                if (const Cell* cell = findCell(x, y)) {
+                    collect(*cell);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Finds every object within a distance of a point.
+     * @param centre The centre of the search circle.
+     * @param radius The search radius.
+     * @param results Receives the handles of the objects found.
+     */
+    void UniformGridIndex::queryRadius(const sf::Vector2f& centre, float radius, std::vector<GameObjectHandle>& results) const {
+        const std::size_t first = results.size();
+        queryAABB(sf::FloatRect(centre - sf::Vector2f(radius, radius), sf::Vector2f(radius * 2.f, radius * 2.f)), results);
+
+        const float radiusSquared = radius * radius;
+        const auto outside = std::remove_if(results.begin() + first, results.end(), [&](const GameObjectHandle& handle) {
+            const sf::Vector2f offset = entries[handle.index].position - centre;
+            return offset.x * offset.x + offset.y * offset.y > radiusSquared;
+            });
+        results.erase(outside, results.end());
+    }
+
+    /**
+     * @brief Finds the objects closest to a point.
+     *
+     * Searches rings of cells outward from the point's cell and stops once the next ring
+     * cannot hold anything closer than the furthest candidate kept.
+     * @param point The point to search from.
+     * @param count The maximum number of objects to return.
+     * @param results Receives the handles found, closest first.
+     */
+    void UniformGridIndex::queryNearest(const sf::Vector2f& point, std::size_t count, std::vector<GameObjectHandle>& results) const {
+        if (count == 0 || objectCount == 0) {
+            return;
+        }
+
+        std::vector<Candidate> heap;
+        heap.reserve(std::min(count, objectCount));
+
+        const auto consider = [&](const Cell& cell) {
+            for (std::uint32_t slot : cell.slots) {
+                const sf::Vector2f offset = entries[slot].position - point;
+                offerCandidate(heap, count, offset.x * offset.x + offset.y * offset.y, slot);
+            }
+            };
+
+        const std::int32_t cx = toCell(point.x);
+        const std::int32_t cy = toCell(point.y);
+        const std::int32_t maxRing = std::max({ cx - minCellX, maxCellX - cx, cy - minCellY, maxCellY - cy, 0 });
+
+        for (std::int32_t ring = 0; ring <= maxRing; ++ring) {
+            // Sparse grids: a full scan of the occupied cells is cheaper than walking empty rings
+            const double ringCells = ring == 0 ? 1.0 : 8.0 * ring;
+            if (ringCells > static_cast<double>(cellLookup.size())) {
+                heap.clear();
+                for (const auto& [key, cellIndex] : cellLookup) {
+                    consider(cells[cellIndex]);
+                }
+                break;
+            }
+
+            for (std::int32_t y = cy - ring; y <= cy + ring; ++y) {
+                const bool edgeRow = y == cy - ring || y == cy + ring;
+                const std::int32_t step = edgeRow || ring == 0 ? 1 : 2 * ring;
+                for (std::int32_t x = cx - ring; x <= cx + ring; x += step) {
+                    if (const Cell* cell = findCell(x, y)) {
+                        consider(*cell);
+                    }
+                }
+            }
+
+            const float reach = static_cast<float>(ring) * cellSize;
+            if (heap.size() == count && heap.front().first <= reach * reach) {
+                break;
+            }
+        }
+
+        std::sort_heap(heap.begin(), heap.end());
+        for (const Candidate& candidate : heap) {
+            results.push_back({ candidate.second, entries[candidate.second].generation });
+        }
+    }
+
+} // namespace KryptosEngine
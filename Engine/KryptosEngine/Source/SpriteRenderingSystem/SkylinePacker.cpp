@@ -0,0 +1,127 @@
+/*
+ * SkylinePacker.cpp - Kryptos Rectangle Packer Implementation
+ * -----------------------------------------------------------
+ * Implements placement and skyline maintenance for the SkylinePacker.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SkylinePacker.h: Header for the SkylinePacker class.
+ *   - algorithm: For skyline heights.
+ */
+
+#include "../Include/SpriteRenderingSystem/SkylinePacker.h"
+#include <algorithm>
+
+/**
+ * @brief Constructs an empty page.
+ * @param width Width of the page.
+ * @param height Height of the page.
+ */
+SkylinePacker::SkylinePacker(std::uint32_t width, std::uint32_t height)
+    : width(width),
+    height(height) {
+    clear();
+}
+
+/**
+ * @brief Empties the page, leaving a single segment at height zero.
+ */
+void SkylinePacker::clear() {
+    skyline.clear();
+    skyline.push_back({ 0, 0, width });
+    usedArea = 0;
+}
+
+/**
+ * @brief Finds the height a rectangle would sit at if its left edge were at a segment.
+ *
+ * The rectangle rests on the highest segment it spans.
+ * @param segment Index of the segment.
+ * @param rectWidth Width of the rectangle.
+ * @param rectHeight Height of the rectangle.
+ * @param y Receives the height the rectangle would sit at.
+ * @return True if the rectangle fits there.
+ */
+bool SkylinePacker::fitsAt(std::size_t segment, std::uint32_t rectWidth, std::uint32_t rectHeight, std::uint32_t& y) const {
+    const std::uint32_t x = skyline[segment].x;
+    if (x + rectWidth > width) {
+        return false;
+    }
+
+    y = 0;
+    std::uint32_t remaining = rectWidth;
+    for (std::size_t i = segment; remaining > 0; ++i) {
+        y = std::max(y, skyline[i].y);
+        if (y + rectHeight > height) {
+            return false;
+        }
+        remaining -= std::min(remaining, skyline[i].width);
+    }
+    return true;
+}
+
+/**
+ * @brief Places a rectangle on the page.
+ *
+ * The new segment covering the rectangle replaces the parts of the segments below it, and
+ * neighbouring segments at equal heights are merged.
+ * @param rectWidth Width of the rectangle.
+ * @param rectHeight Height of the rectangle.
+ * @param placement Receives the rectangle's position.
+ * @return False if the rectangle does not fit; the page is then unchanged.
+ */
+bool SkylinePacker::insert(std::uint32_t rectWidth, std::uint32_t rectHeight, Placement& placement) {
+    if (rectWidth == 0 || rectHeight == 0 || rectWidth > width || rectHeight > height) {
+        return false;
+    }
+
+    std::size_t best = skyline.size();
+    std::uint32_t bestTop = 0;
+    std::uint32_t bestWidth = 0;
+    for (std::size_t i = 0; i < skyline.size(); ++i) {
+        std::uint32_t y;
+        if (!fitsAt(i, rectWidth, rectHeight, y)) {
+            continue;
+        }
+        const std::uint32_t top = y + rectHeight;
+        if (best == skyline.size() || top < bestTop || (top == bestTop && skyline[i].width < bestWidth)) {
+            best = i;
+            bestTop = top;
+            bestWidth = skyline[i].width;
+            placement = { skyline[i].x, y };
+        }
+    }
+    if (best == skyline.size()) {
+        return false;
+    }
+
+    // Cut the covered span out of the segments to the right of the new one
+    skyline.insert(skyline.begin() + best, { placement.x, bestTop, rectWidth });
+    const std::uint32_t right = placement.x + rectWidth;
+    std::size_t i = best + 1;
+    while (i < skyline.size() && skyline[i].x < right) {
+        const std::uint32_t segmentRight = skyline[i].x + skyline[i].width;
+        if (segmentRight <= right) {
+            skyline.erase(skyline.begin() + i);
+            continue;
+        }
+        skyline[i].width = segmentRight - right;
+        skyline[i].x = right;
+        break;
+    }
+
+    for (std::size_t j = 0; j + 1 < skyline.size();) {
+        if (skyline[j].y == skyline[j + 1].y) {
+            skyline[j].width += skyline[j + 1].width;
+            skyline.erase(skyline.begin() + j + 1);
+        }
+        else {
+            ++j;
+        }
+    }
+
+    usedArea += static_cast<std::uint64_t>(rectWidth) * rectHeight;
+    return true;
+}
@@ -0,0 +1,130 @@
+/*
+ * SpriteBatch.cpp - Kryptos Batched Sprite Rendering Implementation
+ * -----------------------------------------------------------------
+ * Implements culling, per-texture grouping and submission of batched sprites.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - SpriteBatch.h: Header for the SpriteBatch class.
+ *   - GameObjectManager.h: For finding every object holding a SpriteRenderer.
+ *   - algorithm, cmath: For sprite bounds.
+ */
+
+#include "../Include/SpriteRenderingSystem/SpriteBatch.h"
+#include "../Include/GameObjectSystem/GameObjectManager.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Starts a frame, discarding the sprites of the previous one.
+ *
+ * The vertex arrays are cleared but keep their storage. A rotated view is culled against the
+ * square enclosing it.
+ * @param target The target the batch will be drawn to.
+ */
+void SpriteBatch::begin(const sf::RenderTarget& target) {
+    for (TextureBatch& batch : batches) {
+        batch.vertices.clear();
+    }
+    spriteCount = 0;
+    culledCount = 0;
+
+    const sf::View& view = target.getView();
+    sf::Vector2f size = view.getSize();
+    if (view.getRotation() != sf::Angle::Zero) {
+        const float diagonal = std::sqrt(size.x * size.x + size.y * size.y);
+        size = sf::Vector2f(diagonal, diagonal);
+    }
+    visibleArea = sf::FloatRect(view.getCenter() - size / 2.f, size);
+}
+
+/**
+ * @brief Adds a sprite to the frame, unless it lies outside the visible area.
+ *
+ * The sprite's quad is transformed on the CPU and written as two triangles, since a batch
+ * draws every sprite with one shared transform.
+ * @param renderer The sprite; renderers without a texture are ignored.
+ */
+void SpriteBatch::add(const SpriteRenderer& renderer) {
+    const sf::Sprite* sprite = renderer.getSprite();
+    if (sprite == nullptr) {
+        return;
+    }
+
+    const sf::IntRect rect = sprite->getTextureRect();
+    const float width = static_cast<float>(std::abs(rect.size.x));
+    const float height = static_cast<float>(std::abs(rect.size.y));
+    const sf::Transform& transform = sprite->getTransform();
+    const sf::Vector2f topLeft = transform.transformPoint(sf::Vector2f(0.f, 0.f));
+    const sf::Vector2f topRight = transform.transformPoint(sf::Vector2f(width, 0.f));
+    const sf::Vector2f bottomLeft = transform.transformPoint(sf::Vector2f(0.f, height));
+    const sf::Vector2f bottomRight = transform.transformPoint(sf::Vector2f(width, height));
+
+    const float minX = std::min({ topLeft.x, topRight.x, bottomLeft.x, bottomRight.x });
+    const float maxX = std::max({ topLeft.x, topRight.x, bottomLeft.x, bottomRight.x });
+    const float minY = std::min({ topLeft.y, topRight.y, bottomLeft.y, bottomRight.y });
+    const float maxY = std::max({ topLeft.y, topRight.y, bottomLeft.y, bottomRight.y });
+    if (maxX < visibleArea.position.x || minX > visibleArea.position.x + visibleArea.size.x ||
+        maxY < visibleArea.position.y || minY > visibleArea.position.y + visibleArea.size.y) {
+        ++culledCount;
+        return;
+    }
+
+    const sf::Texture* texture = &sprite->getTexture();
+    const auto [it, inserted] = batchByTexture.try_emplace(texture, static_cast<std::uint32_t>(batches.size()));
+    if (inserted) {
+        batches.push_back({ texture, sf::VertexArray(sf::PrimitiveType::Triangles) });
+    }
+    sf::VertexArray& vertices = batches[it->second].vertices;
+
+    const float left = static_cast<float>(rect.position.x);
+    const float top = static_cast<float>(rect.position.y);
+    const float right = left + static_cast<float>(rect.size.x);
+    const float bottom = top + static_cast<float>(rect.size.y);
+    const sf::Color color = sprite->getColor();
+
+    vertices.append({ topLeft, color, sf::Vector2f(left, top) });
+    vertices.append({ topRight, color, sf::Vector2f(right, top) });
+    vertices.append({ bottomLeft, color, sf::Vector2f(left, bottom) });
+    vertices.append({ bottomLeft, color, sf::Vector2f(left, bottom) });
+    vertices.append({ topRight, color, sf::Vector2f(right, top) });
+    vertices.append({ bottomRight, color, sf::Vector2f(right, bottom) });
+    ++spriteCount;
+}
+
+/**
+ * @brief Adds the sprite of every active game object holding a SpriteRenderer.
+ *
+ * Objects are found through a component view, which matches whole update buckets.
+ */
+void SpriteBatch::addObjects() {
+    // Compared rather than read from the change flags, which miss moves made while an object
+    // was inactive or in a frame that was not drawn
+    GameObjectManager::getInstance().view<SpriteRenderer>().each([this](const GameObject& object, SpriteRenderer& renderer) {
+        renderer.updatePendingTexture();
+        const sf::Vector2f position = object.getPosition();
+        if (renderer.getPosition() != position) {
+            renderer.setPosition(position);
+        }
+        add(renderer);
+        });
+}
+
+/**
+ * @brief Draws every sprite added since begin, one draw call per texture.
+ * @param target The target to draw to.
+ */
+void SpriteBatch::draw(sf::RenderTarget& target) {
+    drawCallCount = 0;
+    for (const TextureBatch& batch : batches) {
+        if (batch.vertices.getVertexCount() == 0) {
+            continue;
+        }
+        sf::RenderStates states;
+        states.texture = batch.texture;
+        target.draw(batch.vertices, states);
+        ++drawCallCount;
+    }
+}
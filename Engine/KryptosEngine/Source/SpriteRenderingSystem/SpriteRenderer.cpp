@@ -8,14 +8,13 @@
  *
  * Dependencies:
  *   - SpriteRenderer.h: Header for the SpriteRenderer class.
- *   - stdexcept: For exception handling.
+ *   - TextureAtlas.h: Source of the sprites' textures.
+ *   - TextureLoader.h: Source of textures loaded in the background and of the placeholder.
+ *   - cstdlib: For the size of flipped texture rectangles.
  */
 
 #include "../Include/SpriteRenderingSystem/SpriteRenderer.h"
-#include <stdexcept>
-
- // Initialize the static texture cache
-std::unordered_map<std::string, std::shared_ptr<sf::Texture>> SpriteRenderer::textureCache;
+#include <cstdlib>
 
 /**
  * @brief Constructs a SpriteRenderer object.
@@ -26,26 +25,88 @@ SpriteRenderer::SpriteRenderer() : sprite(nullptr), texture(nullptr) {}
 /**
  * @brief Loads a texture from a file and sets it for the sprite.
  *
- * If the texture is already cached, it reuses the cached instance. Otherwise, it loads
- * the texture from the specified file and stores it in the cache.
+ * The texture's region in the TextureAtlas is reused if the file was loaded before;
+ * otherwise the file is decoded and packed into an atlas page. The sprite shows the
+ * region's rectangle of the page.
  * @param texturePath The file path of the texture to load.
  * @throws std::runtime_error If the texture cannot be loaded.
  */
 void SpriteRenderer::loadTexture(const std::string& texturePath) {
-    auto it = textureCache.find(texturePath);
-    if (it != textureCache.end()) {
-        texture = it->second;
+    const AtlasRegion& region = TextureAtlas::getInstance().load(texturePath);
+    pendingTexture.reset();
+    texture = region.page;
+    sprite = std::make_unique<sf::Sprite>(*texture, region.rect);
+    applyRelativeOrigin();
+}
+
+/**
+ * @brief Starts loading a texture in the background and shows a placeholder until it is ready.
+ *
+ * Sprites requesting the same file share one load. If the file is already in the atlas, the
+ * texture is shown at once.
+ * @param texturePath The file path of the texture to load.
+ */
+void SpriteRenderer::loadTextureAsync(const std::string& texturePath) {
+    pendingTexture = TextureLoader::getInstance().request(texturePath);
+    if (!updatePendingTexture()) {
+        setRegion(TextureLoader::getInstance().getPlaceholder());
     }
-    else {
-        auto newTexture = std::make_shared<sf::Texture>();
-        if (!newTexture->loadFromFile(texturePath)) {
-            throw std::runtime_error("Failed to load texture from: " + texturePath);
+}
+
+/**
+ * @brief Swaps the placeholder for the texture being loaded once its load has finished.
+ *
+ * A failed load leaves the placeholder in place and stops waiting.
+ * @return True if the sprite's texture changed.
+ */
+bool SpriteRenderer::updatePendingTexture() {
+    if (!pendingTexture) {
+        return false;
+    }
+    switch (pendingTexture->state) {
+    case TextureLoadState::Ready:
+        setRegion(pendingTexture->region);
+        pendingTexture.reset();
+        if (textureChanged) {
+            textureChanged();
         }
-        textureCache[texturePath] = newTexture;
-        texture = newTexture;
+        return true;
+    case TextureLoadState::Failed:
+        pendingTexture.reset();
+        return false;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Shows an atlas region, keeping the sprite's position, origin, rotation and scale.
+ *
+ * A relative origin is recomputed for the new rectangle's size.
+ * @param region The region to show.
+ */
+void SpriteRenderer::setRegion(const AtlasRegion& region) {
+    texture = region.page;
+    if (sprite) {
+        sprite->setTexture(*texture);
+        sprite->setTextureRect(region.rect);
     }
+    else {
+        sprite = std::make_unique<sf::Sprite>(*texture, region.rect);
+    }
+    applyRelativeOrigin();
+}
 
-    sprite = std::make_unique<sf::Sprite>(*texture);
+/**
+ * @brief Recomputes a relative origin from the size of the texture rectangle shown.
+ */
+void SpriteRenderer::applyRelativeOrigin() {
+    if (!sprite || !originIsRelative) {
+        return;
+    }
+    const sf::IntRect rect = sprite->getTextureRect();
+    sprite->setOrigin(sf::Vector2f(relativeOrigin.x * static_cast<float>(std::abs(rect.size.x)),
+        relativeOrigin.y * static_cast<float>(std::abs(rect.size.y))));
 }
 
 /**
@@ -66,16 +127,44 @@ sf::Vector2f SpriteRenderer::getPosition() const {
     return sprite ? sprite->getPosition() : sf::Vector2f(0.f, 0.f);
 }
 
+/**
+ * @brief Gets the sprite's bounding box relative to its position.
+ * @return The offset bounds, or an empty rectangle if no texture is loaded.
+ */
+sf::FloatRect SpriteRenderer::getOffsetBounds() const {
+    if (!sprite) {
+        return sf::FloatRect();
+    }
+    sf::FloatRect bounds = sprite->getGlobalBounds();
+    bounds.position -= sprite->getPosition();
+    return bounds;
+}
+
 /**
  * @brief Sets the origin of the sprite for transformations.
- * @param origin The new origin of the sprite.
+ *
+ * Replaces any relative origin, so the origin stays put when the texture changes.
+ * @param origin The new origin of the sprite, in pixels.
  */
 void SpriteRenderer::setOrigin(const sf::Vector2f& origin) {
+    originIsRelative = false;
     if (sprite) {
         sprite->setOrigin(origin);
     }
 }
 
+/**
+ * @brief Sets the origin as a fraction of the texture rectangle's size, kept when the texture changes.
+ *
+ * May be called before a texture is loaded; the origin is applied once one is.
+ * @param factor The origin, from (0, 0) for the top-left corner to (1, 1) for the bottom-right.
+ */
+void SpriteRenderer::setRelativeOrigin(const sf::Vector2f& factor) {
+    relativeOrigin = factor;
+    originIsRelative = true;
+    applyRelativeOrigin();
+}
+
 /**
  * @brief Sets the rotation of the sprite.
  * @param angle The rotation angle in degrees.
@@ -123,10 +212,11 @@ void SpriteRenderer::draw(sf::RenderWindow& window) const {
 }
 
 /**
- * @brief Clears the global texture cache.
+ * @brief Clears the global texture atlas.
  *
- * Removes all cached textures from memory.
+ * Each sprite holds a reference to its atlas page, so pages in use are freed only once
+ * their last sprite is destroyed.
  */
 void SpriteRenderer::clearCache() {
-    textureCache.clear();
+    TextureAtlas::getInstance().clear();
 }
@@ -0,0 +1,238 @@
+/*
+ * TextureAtlas.cpp - Kryptos Runtime Texture Atlas Implementation
+ * ---------------------------------------------------------------
+ * Implements loading, packing and uploading of images into atlas pages.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - TextureAtlas.h: Header for the TextureAtlas class.
+ *   - AtlasManifestFormat.h: Layout of baked atlas manifests.
+ *   - algorithm: For clamping the page size.
+ *   - cstring, filesystem, fstream: For reading baked manifests.
+ *   - stdexcept: For exception handling.
+ */
+
+#include "../Include/SpriteRenderingSystem/TextureAtlas.h"
+#include "../Include/SpriteRenderingSystem/AtlasManifestFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    /**
+     * Preferred width and height of a shared page.
+     */
+    constexpr unsigned PreferredPageSize = 2048;
+}
+
+/**
+ * @brief Constructs an empty atlas. No page is created until the first image is packed.
+ */
+TextureAtlas::TextureAtlas()
+    : pageSize(std::min(PreferredPageSize, sf::Texture::getMaximumSize())) {
+}
+
+/**
+ * @brief Gets the singleton instance of the TextureAtlas.
+ * @return Reference to the singleton instance.
+ */
+TextureAtlas& TextureAtlas::getInstance() {
+    static TextureAtlas instance;
+    return instance;
+}
+
+/**
+ * @brief Creates a texture of a given size.
+ *
+ * A resized texture's pixels are undefined. Shared pages are cleared so the padding between
+ * images is transparent and smoothing never blends garbage into a sprite's edge.
+ * @param size Size of the texture.
+ * @param clear Whether to make every pixel transparent.
+ * @return The texture.
+ * @throw std::runtime_error if the texture cannot be created.
+ */
+std::shared_ptr<sf::Texture> TextureAtlas::createTexture(sf::Vector2u size, bool clear) {
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->resize(size)) {
+        throw std::runtime_error("Failed to create a " + std::to_string(size.x) + "x" + std::to_string(size.y) + " atlas page");
+    }
+    if (clear) {
+        texture->update(sf::Image(size, sf::Color::Transparent));
+    }
+    return texture;
+}
+
+/**
+ * @brief Gets the region of an image file, loading and packing it on first use.
+ * @param path Path of the image file.
+ * @return The image's region.
+ * @throw std::runtime_error if the file cannot be loaded.
+ */
+const AtlasRegion& TextureAtlas::load(const std::string& path) {
+    if (const AtlasRegion* region = find(path)) {
+        return *region;
+    }
+
+    sf::Image image;
+    if (!image.loadFromFile(path)) {
+        throw std::runtime_error("Failed to load texture from: " + path);
+    }
+    return insert(path, image);
+}
+
+/**
+ * @brief Packs an image already in memory and caches its region under a key.
+ *
+ * Pages are tried oldest first, so early pages fill up before later ones are used.
+ * @param key Key to cache the region under.
+ * @param image The image.
+ * @return The image's region.
+ * @throw std::runtime_error if a page cannot be created.
+ */
+const AtlasRegion& TextureAtlas::insert(const std::string& key, const sf::Image& image) {
+    if (const AtlasRegion* region = find(key)) {
+        return *region;
+    }
+
+    const sf::Vector2u size = image.getSize();
+    AtlasRegion region;
+    if (size.x + Padding > pageSize || size.y + Padding > pageSize) {
+        region.page = createTexture(size, false);
+        region.page->update(image);
+        region.rect = sf::IntRect({ 0, 0 }, sf::Vector2i(size));
+        ++dedicatedPageCount;
+    }
+    else {
+        SkylinePacker::Placement placement{};
+        Page* target = nullptr;
+        for (Page& page : pages) {
+            if (page.packer.insert(size.x + Padding, size.y + Padding, placement)) {
+                target = &page;
+                break;
+            }
+        }
+        if (target == nullptr) {
+            pages.push_back({ createTexture({ pageSize, pageSize }, true), SkylinePacker(pageSize, pageSize) });
+            target = &pages.back();
+            target->packer.insert(size.x + Padding, size.y + Padding, placement);
+        }
+
+        target->texture->update(image, { placement.x, placement.y });
+        region.page = target->texture;
+        region.rect = sf::IntRect(sf::Vector2i(static_cast<int>(placement.x), static_cast<int>(placement.y)), sf::Vector2i(size));
+    }
+
+    return regions.emplace(key, std::move(region)).first->second;
+}
+
+/**
+ * @brief Loads an atlas baked by KryptosTools and caches its sprites' regions by sprite name.
+ *
+ * Every offset is checked against the file size, so a corrupt manifest throws instead of reading out of bounds.
+ * @param path Path of the .katlas manifest.
+ * @return The number of sprites in the manifest.
+ * @throw std::runtime_error if the manifest is invalid or a page cannot be loaded.
+ */
+std::size_t TextureAtlas::loadManifest(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Failed to open atlas manifest: " + path);
+    }
+    std::vector<char> bytes(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+        throw std::runtime_error("Failed to read atlas manifest: " + path);
+    }
+
+    using namespace KryptosEngine;
+    AtlasManifestHeader header;
+    if (bytes.size() < sizeof(header)) {
+        throw std::runtime_error("Atlas manifest is truncated: " + path);
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, AtlasManifestMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Not an atlas manifest: " + path);
+    }
+    if (header.version != AtlasManifestVersion || header.byteOrder != AtlasManifestByteOrder) {
+        throw std::runtime_error("Atlas manifest was baked for another version or platform, rebake it: " + path);
+    }
+    const std::uint64_t size = bytes.size();
+    if (header.fileSize != size || header.stringData > size ||
+        header.pages > size || header.pageCount > (size - header.pages) / sizeof(AtlasManifestPage) ||
+        header.sprites > size || header.spriteCount > (size - header.sprites) / sizeof(AtlasManifestSprite)) {
+        throw std::runtime_error("Atlas manifest is corrupt: " + path);
+    }
+    const std::uint64_t stringSize = size - header.stringData;
+    const char* strings = bytes.data() + header.stringData;
+
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    std::vector<std::shared_ptr<sf::Texture>> textures;
+    for (std::uint32_t i = 0; i < header.pageCount; ++i) {
+        AtlasManifestPage page;
+        std::memcpy(&page, bytes.data() + header.pages + i * sizeof(page), sizeof(page));
+        if (page.fileName + static_cast<std::uint64_t>(page.fileNameLength) > stringSize) {
+            throw std::runtime_error("Atlas manifest is corrupt: " + path);
+        }
+        const std::filesystem::path pagePath = directory / std::string(strings + page.fileName, page.fileNameLength);
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->loadFromFile(pagePath)) {
+            throw std::runtime_error("Failed to load atlas page from: " + pagePath.string());
+        }
+        textures.push_back(std::move(texture));
+    }
+
+    for (std::uint32_t i = 0; i < header.spriteCount; ++i) {
+        AtlasManifestSprite sprite;
+        std::memcpy(&sprite, bytes.data() + header.sprites + i * sizeof(sprite), sizeof(sprite));
+        if (sprite.name + static_cast<std::uint64_t>(sprite.nameLength) > stringSize || sprite.page >= textures.size()) {
+            throw std::runtime_error("Atlas manifest is corrupt: " + path);
+        }
+        AtlasRegion region;
+        region.page = textures[sprite.page];
+        region.rect = sf::IntRect(sf::Vector2i(static_cast<int>(sprite.x), static_cast<int>(sprite.y)),
+            sf::Vector2i(static_cast<int>(sprite.width), static_cast<int>(sprite.height)));
+        regions.emplace(std::string(strings + sprite.name, sprite.nameLength), std::move(region));
+    }
+
+    bakedPageCount += textures.size();
+    return header.spriteCount;
+}
+
+/**
+ * @brief Finds the cached region of a key.
+ * @param key The key.
+ * @return The region, or nullptr if the key was never loaded.
+ */
+const AtlasRegion* TextureAtlas::find(const std::string& key) const {
+    const auto it = regions.find(key);
+    return it != regions.end() ? &it->second : nullptr;
+}
+
+/**
+ * @brief Forgets every region and page.
+ */
+void TextureAtlas::clear() {
+    regions.clear();
+    pages.clear();
+    dedicatedPageCount = 0;
+    bakedPageCount = 0;
+}
+
+/**
+ * @brief Gets the fraction of the shared pages covered by images, padding included.
+ * @return A value from 0 to 1, or 0 with no shared pages.
+ */
+float TextureAtlas::getOccupancy() const {
+    if (pages.empty()) {
+        return 0.f;
+    }
+    float total = 0.f;
+    for (const Page& page : pages) {
+        total += page.packer.getOccupancy();
+    }
+    return total / static_cast<float>(pages.size());
+}
@@ -0,0 +1,194 @@
+/*
+ * TextureLoader.cpp - Kryptos Asynchronous Texture Loader Implementation
+ * ----------------------------------------------------------------------
+ * Implements background decoding and budgeted uploading of textures.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - TextureLoader.h: Header for the TextureLoader class.
+ *   - Logger.h: For reporting files that fail to load.
+ *   - algorithm: For sizing the worker pool.
+ *   - stdexcept: For catching failed uploads.
+ */
+
+#include "../Include/SpriteRenderingSystem/TextureLoader.h"
+#include "../Include/LoggingSystem/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    /**
+     * Most decode workers to start. Decoding is mostly bound by file reads and inflation,
+     * so a couple of threads keep up without competing with the JobSystem.
+     */
+    constexpr unsigned MaxWorkers = 2;
+
+    /**
+     * Width and height of the placeholder image, and of each of its checker squares.
+     */
+    constexpr unsigned PlaceholderSize = 16;
+    constexpr unsigned PlaceholderSquare = 8;
+}
+
+/**
+ * @brief Starts the decode workers, leaving one hardware thread for the main thread.
+ */
+TextureLoader::TextureLoader() {
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    const unsigned workerCount = std::clamp(hardwareThreads > 1 ? hardwareThreads - 1 : 1u, 1u, MaxWorkers);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&TextureLoader::workerLoop, this);
+    }
+}
+
+/**
+ * @brief Stops and joins the decode workers.
+ *
+ * Workers check for shutdown only between requests, so a decode in progress finishes before
+ * its worker is joined. Requests still waiting to be decoded or uploaded are abandoned.
+ */
+TextureLoader::~TextureLoader() {
+    {
+        std::lock_guard<std::mutex> lock(decodeMutex);
+        running = false;
+    }
+    decodeCondition.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Gets the singleton instance of the TextureLoader.
+ * @return Reference to the singleton instance.
+ */
+TextureLoader& TextureLoader::getInstance() {
+    static TextureLoader instance;
+    return instance;
+}
+
+/**
+ * @brief Decodes queued requests until shutdown.
+ *
+ * The request stays owned by inFlight until it is uploaded, so handing the raw pointer to
+ * the decoded queue is safe.
+ */
+void TextureLoader::workerLoop() {
+    for (;;) {
+        std::shared_ptr<TextureRequest> request;
+        {
+            std::unique_lock<std::mutex> lock(decodeMutex);
+            decodeCondition.wait(lock, [this]() {
+                return !running || !decodeQueue.empty();
+                });
+            if (!running) {
+                return;
+            }
+            request = std::move(decodeQueue.front());
+            decodeQueue.pop_front();
+        }
+
+        request->decoded = request->image.loadFromFile(request->path);
+        decodedQueue.push(request.get());
+    }
+}
+
+/**
+ * @brief Starts loading an image file, or joins the load already in flight.
+ * @param path Path of the image file.
+ * @return The request, which is already Ready if the path is in the atlas.
+ */
+std::shared_ptr<const TextureRequest> TextureLoader::request(const std::string& path) {
+    if (const auto it = inFlight.find(path); it != inFlight.end()) {
+        return it->second;
+    }
+
+    auto request = std::make_shared<TextureRequest>();
+    request->path = path;
+    if (const AtlasRegion* region = TextureAtlas::getInstance().find(path)) {
+        request->region = *region;
+        request->state = TextureLoadState::Ready;
+        return request;
+    }
+
+    inFlight.emplace(path, request);
+    {
+        std::lock_guard<std::mutex> lock(decodeMutex);
+        decodeQueue.push_back(request);
+    }
+    decodeCondition.notify_one();
+    return request;
+}
+
+/**
+ * @brief Packs decoded images into the atlas until a time budget is spent.
+ *
+ * Uploads run oldest first. The budget is checked between uploads, so one large image can
+ * overrun it; the images after it wait for the next frame.
+ * @param budget Time the uploads may take this frame.
+ * @return The number of requests completed, failures included.
+ */
+std::size_t TextureLoader::processUploads(sf::Time budget) {
+    for (TextureRequest* request = decodedQueue.takeAll(); request != nullptr; ) {
+        TextureRequest* next = request->next;
+        request->state = TextureLoadState::Uploading;
+        uploadQueue.push_back(request);
+        request = next;
+    }
+
+    const sf::Clock clock;
+    std::size_t completed = 0;
+    while (!uploadQueue.empty() && (completed == 0 || clock.getElapsedTime() < budget)) {
+        TextureRequest* request = uploadQueue.front();
+        uploadQueue.pop_front();
+
+        if (request->decoded) {
+            try {
+                request->region = TextureAtlas::getInstance().insert(request->path, request->image);
+                request->state = TextureLoadState::Ready;
+            }
+            catch (const std::runtime_error& e) {
+                KryptosEngine::Logger::GetLogger()->error("Failed to upload texture {}: {}", request->path, e.what());
+                request->state = TextureLoadState::Failed;
+            }
+            request->image = sf::Image();
+        }
+        else {
+            KryptosEngine::Logger::GetLogger()->error("Failed to load texture from: {}", request->path);
+            request->state = TextureLoadState::Failed;
+        }
+
+        // May free the request if no sprite is waiting for it, so erase by iterator, not by its path
+        inFlight.erase(inFlight.find(request->path));
+        ++completed;
+    }
+
+    lastUploadCount = completed;
+    return completed;
+}
+
+/**
+ * @brief Gets the region of the placeholder, a magenta and black checkerboard.
+ *
+ * The placeholder is packed into the atlas like any other image, so sprites waiting for
+ * their texture still batch with the rest.
+ * @return The placeholder's region.
+ */
+const AtlasRegion& TextureLoader::getPlaceholder() {
+    TextureAtlas& atlas = TextureAtlas::getInstance();
+    if (const AtlasRegion* region = atlas.find(PlaceholderKey)) {
+        return *region;
+    }
+
+    sf::Image image({ PlaceholderSize, PlaceholderSize }, sf::Color::Black);
+    for (unsigned y = 0; y < PlaceholderSize; ++y) {
+        for (unsigned x = 0; x < PlaceholderSize; ++x) {
+            if (((x / PlaceholderSquare) + (y / PlaceholderSquare)) % 2 == 0) {
+                image.setPixel({ x, y }, sf::Color::Magenta);
+            }
+        }
+    }
+    return atlas.insert(PlaceholderKey, image);
+}
@@ -2,6 +2,13 @@
 #include <SFML/Window/Event.hpp>
 #include "../include/Initialisers/EngineInit.h"
 #include "PlayerClass/Player.h"
+#include "GameObjectSystem/GameObjectManager.h"
+#include "PhysicsSystem/PhysicsSystem.h"
+#include "SceneSystem/SceneGraph.h"
+#include "SerializationSystem/StateHistory.h"
+#include "EventSystem/EventBus.h"
+#include "SpriteRenderingSystem/SpriteBatch.h"
+#include "SpriteRenderingSystem/TextureLoader.h"
 #include "DebugWindow/DebugWindow.h"
 #include <iostream>
 
@@ -26,14 +33,26 @@ int main() {
     // Path to the player texture
     std::string playerTexturePath = "D:\\Personal Projects\\Working Title - Kryptos\\Art\\KryptosPlayerSprite\\KrillConcept03.png";
 
-    // Declare Player
-    Player player("Kryptos", sf::Vector2(100.f, 300.f), playerTexturePath);
-    Player anotherPlayer("Athena", sf::Vector2(200.f, 400.f), playerTexturePath); // Example additional player
+    // Spawn Players from the engine's object pools
+    GameObjectManager& gameObjectManager = GameObjectManager::getInstance();
+    Player* player = gameObjectManager.spawn<Player>("Kryptos", sf::Vector2(100.f, 300.f), playerTexturePath);
+    Player* anotherPlayer = gameObjectManager.spawn<Player>("Athena", sf::Vector2(200.f, 400.f), playerTexturePath); // Example additional player
+
+    // Tick objects far from the player less often
+    gameObjectManager.setUpdateLod(player->getHandle(), 1000.f, 2000.f, 4000.f);
 
     // Create the Debug Window
 	KryptosEngine::DebugWindow::DebugWindow debugWindow;
 	debugWindow.initialise();
 
+    // Keep the last two seconds of object state for rewinding with F2
+    KryptosEngine::StateHistory history(120, 1 << 16);
+
+    KryptosEngine::EventBus& eventBus = KryptosEngine::EventBus::getInstance();
+
+    // Draws every object's sprite with one draw call per texture
+    SpriteBatch spriteBatch;
+
     sf::Clock clock;
 
     // Start the game loop
@@ -45,21 +64,39 @@ int main() {
                 window.close();
                 debugWindow.close(); // Close the debug window as well
             }
+
+            // Rewind: jump back to the oldest buffered frame
+            const auto* keyPressed = event->getIf<sf::Event::KeyPressed>();
+            if (keyPressed && keyPressed->code == sf::Keyboard::Key::F2) {
+                history.restore(history.getOldestFrame());
+                eventBus.clear();
+            }
         }
 
         // Calculate delta time
         float deltaTime = clock.restart().asSeconds();
 
-        // Update Players
-        player.update(deltaTime);
-        anotherPlayer.update(deltaTime);
+        // Update all game objects
+        gameObjectManager.updateAll(deltaTime);
+        eventBus.dispatch(KryptosEngine::EventStage::PostUpdate);
+
+        // Step physics on its fixed timestep
+        KryptosEngine::PhysicsSystem::getInstance().update(deltaTime);
+
+        // Propagate parent transforms to attached children
+        KryptosEngine::SceneGraph::getInstance().update();
+        eventBus.dispatch(KryptosEngine::EventStage::PostPhysics);
+
+        // Upload textures decoded in the background, spending at most 2ms of the frame
+        TextureLoader::getInstance().processUploads(sf::milliseconds(2));
 
         // Clear screen
         window.clear();
 
-        // Render Players
-        player.draw(window);
-        anotherPlayer.draw(window);
+        // Render every sprite-holding object, Players included
+        spriteBatch.begin(window);
+        spriteBatch.addObjects();
+        spriteBatch.draw(window);
 
         debugWindow.handleInput();
 
@@ -70,7 +107,19 @@ int main() {
 
         // Update the main window
         window.display();
+
+        eventBus.dispatch(KryptosEngine::EventStage::EndOfFrame);
+
+        // Record the frame, then clear its changes once every consumer has seen them
+        history.capture(deltaTime);
+        gameObjectManager.clearChanges();
     }
 
+    // Apply any destructions other threads queued after the last frame
+    gameObjectManager.publishRegistrations();
+
+    gameObjectManager.despawn(anotherPlayer);
+    gameObjectManager.despawn(player);
+
     return 0;
 }
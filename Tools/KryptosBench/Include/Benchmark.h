@@ -0,0 +1,134 @@
+/*
+ * Benchmark.h - Kryptos Benchmark Harness
+ * ---------------------------------------
+ * Declares the timing helpers shared by the KryptosBench benchmarks and the
+ * entry point of each benchmark. Benchmarks run headless and print one row
+ * per measured case, so their output can be kept alongside the change that
+ * motivated them. Measure optimised Release builds only.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - chrono: For timing each run.
+ *   - vector, string, cstddef: For samples and labels.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace KryptosBench {
+
+    /**
+     * @brief Summary of the runs of one measured case, in microseconds.
+     */
+    struct Timing {
+        double median = 0.0;   ///< Median run time.
+        double fastest = 0.0;  ///< Fastest run time.
+        std::size_t runs = 0;  ///< Number of timed runs.
+    };
+
+    /**
+     * @brief Summarises run times. Reorders the samples.
+     * @param samples Run times, in microseconds.
+     * @return The median and fastest run times.
+     */
+    Timing summarise(std::vector<double>& samples);
+
+    /**
+     * @brief Times a piece of work.
+     *
+     * The work is run untimed warmupRuns times first, so caches, pools and lazily built
+     * tables are warm before timing starts.
+     * @param warmupRuns Untimed runs made first.
+     * @param runs Timed runs.
+     * @param work The work to time.
+     * @return The median and fastest of the timed runs.
+     */
+    template <typename Work>
+    Timing measure(std::size_t warmupRuns, std::size_t runs, Work&& work) {
+        for (std::size_t i = 0; i < warmupRuns; ++i) {
+            work();
+        }
+
+        std::vector<double> samples;
+        samples.reserve(runs);
+        for (std::size_t i = 0; i < runs; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            work();
+            const auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+        return summarise(samples);
+    }
+
+    /**
+     * @brief Times a piece of work, running untimed preparation before every run.
+     *
+     * For work whose input is consumed by each run, such as a frame's change list.
+     * @param warmupRuns Untimed runs made first.
+     * @param runs Timed runs.
+     * @param prepare Sets up the input of the next run; not timed.
+     * @param work The work to time.
+     * @return The median and fastest of the timed runs.
+     */
+    template <typename Prepare, typename Work>
+    Timing measure(std::size_t warmupRuns, std::size_t runs, Prepare&& prepare, Work&& work) {
+        for (std::size_t i = 0; i < warmupRuns; ++i) {
+            prepare();
+            work();
+        }
+
+        std::vector<double> samples;
+        samples.reserve(runs);
+        for (std::size_t i = 0; i < runs; ++i) {
+            prepare();
+            const auto start = std::chrono::steady_clock::now();
+            work();
+            const auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+        return summarise(samples);
+    }
+
+    /**
+     * @brief Prints the title and column headings of a benchmark.
+     */
+    void printTitle(const std::string& title);
+
+    /**
+     * @brief Prints one measured case.
+     * @param label Description of the case.
+     * @param timing Timing of the case.
+     * @param items Number of items each run processed, used for the per-item cost.
+     */
+    void printTiming(const std::string& label, const Timing& timing, std::size_t items);
+
+    /**
+     * @brief Compares updateAll over objects of mixed, unregistered types with per-type update buckets.
+     */
+    void runUpdateBenchmark();
+
+    /**
+     * @brief Compares the uniform grid and loose quadtree spatial indices at 100,000 objects.
+     */
+    void runSpatialBenchmark();
+
+    /**
+     * @brief Compares drawing each sprite with its own draw call against a SpriteBatch.
+     */
+    void runSpriteBenchmark();
+
+    /**
+     * @brief Compares saving and loading WorldSnapshots of 100,000 objects against a naive text format.
+     */
+    void runSnapshotBenchmark();
+
+    /**
+     * @brief Times StateHistory::capture over 10,000 objects with different shares changed.
+     */
+    void runHistoryBenchmark();
+}
@@ -0,0 +1,52 @@
+/*
+ * Benchmark.cpp - Kryptos Benchmark Harness Implementation
+ * --------------------------------------------------------
+ * Implements the timing summary and the table output shared by the
+ * KryptosBench benchmarks.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Header for the harness.
+ *   - algorithm: For the median.
+ *   - iostream, iomanip: For the table output.
+ */
+
+#include "../Include/Benchmark.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace KryptosBench {
+
+    Timing summarise(std::vector<double>& samples) {
+        Timing timing;
+        timing.runs = samples.size();
+        if (samples.empty()) {
+            return timing;
+        }
+
+        const auto middle = samples.begin() + samples.size() / 2;
+        std::nth_element(samples.begin(), middle, samples.end());
+        timing.median = *middle;
+        timing.fastest = *std::min_element(samples.begin(), samples.end());
+        return timing;
+    }
+
+    void printTitle(const std::string& title) {
+        std::cout << '\n' << title << '\n'
+            << std::left << std::setw(44) << "case"
+            << std::right << std::setw(14) << "median us"
+            << std::setw(14) << "fastest us"
+            << std::setw(14) << "ns/item" << '\n';
+    }
+
+    void printTiming(const std::string& label, const Timing& timing, std::size_t items) {
+        const double perItem = items > 0 ? timing.median * 1000.0 / static_cast<double>(items) : 0.0;
+        std::cout << std::left << std::setw(44) << label << std::right << std::fixed
+            << std::setprecision(1) << std::setw(14) << timing.median
+            << std::setw(14) << timing.fastest
+            << std::setprecision(2) << std::setw(14) << perItem << std::endl;
+    }
+}
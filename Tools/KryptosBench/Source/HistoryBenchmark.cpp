@@ -0,0 +1,86 @@
+/*
+ * HistoryBenchmark.cpp - Kryptos Frame History Benchmark
+ * ------------------------------------------------------
+ * Times StateHistory::capture over 10,000 objects when none, a tenth or
+ * all of them changed during the frame, with the history sized as the game
+ * sizes it: 120 frames and 65,536 records. The changes are made before
+ * each run and are not timed; capture is timed alone. The full baseline
+ * taken by reset is timed for comparison.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Timing helpers.
+ *   - StateHistory.h: The history being measured.
+ *   - GameObjectManager.h: The objects being changed.
+ */
+
+#include "../Include/Benchmark.h"
+#include "../../../Engine/KryptosEngine/Include/SerializationSystem/StateHistory.h"
+#include "../../../Engine/KryptosEngine/Include/GameObjectSystem/GameObjectManager.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::size_t ObjectCount = 10000;
+
+    /**
+     * @brief Object recorded by the benchmark.
+     */
+    class HistoryObject : public GameObject {
+    public:
+        explicit HistoryObject(const sf::Vector2f& position)
+            : GameObject("history", position, true, sf::radians(0.f), 1.f, false) {
+        }
+    };
+
+    /**
+     * @brief Times capture with every stride-th object moved before each frame.
+     * @param stride 1 to change every object, 0 to change none.
+     */
+    void measureCapture(KryptosEngine::StateHistory& history, const std::vector<GameObject*>& objects, std::size_t stride) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        const std::size_t changed = stride == 0 ? 0 : (objects.size() + stride - 1) / stride;
+
+        const KryptosBench::Timing timing = KryptosBench::measure(20, 500, [&] {
+            manager.clearChanges();
+            for (std::size_t i = 0; stride != 0 && i < objects.size(); i += stride) {
+                objects[i]->setPosition(objects[i]->getPosition() + sf::Vector2f(1.f, 0.5f));
+            }
+        }, [&] {
+            history.capture(1.f / 60.f);
+        });
+        KryptosBench::printTiming("capture, " + std::to_string(changed) + " of " + std::to_string(objects.size())
+            + " changed", timing, objects.size());
+    }
+}
+
+namespace KryptosBench {
+
+    void runHistoryBenchmark() {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        std::vector<GameObject*> objects;
+        objects.reserve(ObjectCount);
+        for (std::size_t i = 0; i < ObjectCount; ++i) {
+            objects.push_back(manager.create<HistoryObject>(sf::Vector2f(static_cast<float>(i % 100), static_cast<float>(i / 100))));
+        }
+        manager.clearChanges();
+
+        KryptosEngine::StateHistory history(120, 1 << 16);
+
+        printTitle("StateHistory: capture over 10000 objects, 120 frames and 65536 records");
+        measureCapture(history, objects, 0);
+        measureCapture(history, objects, 10);
+        measureCapture(history, objects, 1);
+        printTiming("reset, 10000 objects", measure(5, 100, [&] {
+            history.reset();
+        }), ObjectCount);
+
+        manager.clearChanges();
+        for (GameObject* object : objects) {
+            manager.destroy(object);
+        }
+    }
+}
@@ -0,0 +1,224 @@
+/*
+ * SnapshotBenchmark.cpp - Kryptos World Snapshot Benchmark
+ * --------------------------------------------------------
+ * Times saving and loading 100,000 objects with WorldSnapshot against a
+ * naive text serializer that writes one line per object with iostreams and
+ * parses it back with operator>>, the format a snapshot would otherwise be
+ * kept in. Both record the same fields and apply them through the same
+ * GameObject setters, so the restore rows differ only in how the file is
+ * read. Files are read from the OS cache after the warm-up runs.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Timing helpers.
+ *   - WorldSnapshot.h, MappedSnapshot.h: The binary snapshots being measured.
+ *   - GameObjectManager.h: The objects being saved and restored.
+ *   - fstream, iomanip: For the text serializer.
+ *   - iostream: For the file sizes.
+ *   - filesystem: For the snapshot files.
+ */
+
+#include "../Include/Benchmark.h"
+#include "../../../Engine/KryptosEngine/Include/SerializationSystem/WorldSnapshot.h"
+#include "../../../Engine/KryptosEngine/Include/SerializationSystem/MappedSnapshot.h"
+#include "../../../Engine/KryptosEngine/Include/GameObjectSystem/GameObjectManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::size_t ObjectCount = 100000;
+
+    /**
+     * @brief Receives the sums of mapped reads, so they are not optimised away.
+     */
+    volatile double readSink = 0.0;
+
+    /**
+     * @brief Object saved and restored by the benchmark.
+     */
+    class SnapshotObject : public GameObject {
+    public:
+        SnapshotObject(const std::string& name, const sf::Vector2f& position, float mass)
+            : GameObject(name, position, true, sf::radians(0.f), mass, false) {
+        }
+    };
+
+    /**
+     * @brief One object as read back by the text serializer.
+     */
+    struct TextRecord {
+        std::string name;
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;
+        float positionX = 0.f;
+        float positionY = 0.f;
+        float rotation = 0.f;
+        float velocityX = 0.f;
+        float velocityY = 0.f;
+        float mass = 0.f;
+        int useGravity = 0;
+        int active = 0;
+    };
+
+    /**
+     * @brief Writes every registered object as one line of text.
+     */
+    void saveText(const std::string& path) {
+        std::ofstream file(path);
+        file << std::setprecision(9);
+        for (GameObject* object : GameObjectManager::getInstance().getGameObjects()) {
+            const GameObjectHandle handle = object->getHandle();
+            const sf::Vector2f position = object->getPosition();
+            const sf::Vector2f velocity = object->getVelocity();
+            file << object->getName() << ' ' << handle.index << ' ' << handle.generation << ' '
+                << position.x << ' ' << position.y << ' ' << object->getRotation().asRadians() << ' '
+                << velocity.x << ' ' << velocity.y << ' ' << object->getMass() << ' '
+                << object->getUseGravity() << ' ' << object->isActive() << '\n';
+        }
+        if (!file) {
+            throw std::runtime_error("Could not write text snapshot " + path);
+        }
+    }
+
+    /**
+     * @brief Parses a file written by saveText.
+     */
+    void loadText(const std::string& path, std::vector<TextRecord>& records) {
+        std::ifstream file(path);
+        records.clear();
+        TextRecord record;
+        while (file >> record.name >> record.index >> record.generation >> record.positionX >> record.positionY
+            >> record.rotation >> record.velocityX >> record.velocityY >> record.mass >> record.useGravity >> record.active) {
+            records.push_back(record);
+        }
+    }
+
+    /**
+     * @brief Applies parsed records the way WorldSnapshot::restore applies a snapshot.
+     * @return The number of objects restored.
+     */
+    std::size_t restoreText(const std::vector<TextRecord>& records) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        std::size_t restored = 0;
+        for (const TextRecord& record : records) {
+            GameObject* object = manager.resolve({ record.index, record.generation });
+            if (object == nullptr || object->getName() != record.name) {
+                continue;
+            }
+
+            object->setPosition(sf::Vector2f(record.positionX, record.positionY));
+            object->setRotation(sf::radians(record.rotation));
+            object->setVelocity(sf::Vector2f(record.velocityX, record.velocityY));
+            object->setMass(record.mass);
+            object->setUseGravity(record.useGravity != 0);
+            object->setActive(record.active != 0);
+            ++restored;
+        }
+        return restored;
+    }
+
+    /**
+     * @brief Reads every field of a mapped snapshot, as spawning a level from it would.
+     * @return A sum of the fields.
+     */
+    double readMapped(const KryptosEngine::MappedSnapshot& snapshot) {
+        const float* positionX = snapshot.getPositionX();
+        const float* positionY = snapshot.getPositionY();
+        const float* rotation = snapshot.getRotation();
+        const float* velocityX = snapshot.getVelocityX();
+        const float* velocityY = snapshot.getVelocityY();
+        const float* mass = snapshot.getMass();
+        const std::uint8_t* useGravity = snapshot.getUseGravity();
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < snapshot.getObjectCount(); ++i) {
+            sum += positionX[i] + positionY[i] + rotation[i] + velocityX[i] + velocityY[i] + mass[i] + useGravity[i];
+            sum += static_cast<double>(snapshot.getName(i).size() + snapshot.getHandle(i).index);
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Fails the benchmark if a load did not restore every object.
+     */
+    void expectRestored(std::size_t restored, const char* format) {
+        if (restored != ObjectCount) {
+            throw std::runtime_error(std::string("The ") + format + " snapshot restored "
+                + std::to_string(restored) + " of " + std::to_string(ObjectCount) + " objects");
+        }
+    }
+}
+
+namespace KryptosBench {
+
+    void runSnapshotBenchmark() {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        std::mt19937 random(1u);
+        std::uniform_real_distribution<float> coordinate(0.f, 10000.f);
+        std::uniform_real_distribution<float> mass(0.5f, 5.f);
+
+        std::vector<GameObject*> objects;
+        objects.reserve(ObjectCount);
+        for (std::size_t i = 0; i < ObjectCount; ++i) {
+            GameObject* object = manager.create<SnapshotObject>("Prop" + std::to_string(i % 1000),
+                sf::Vector2f(coordinate(random), coordinate(random)), mass(random));
+            object->setVelocity({ coordinate(random) / 100.f, coordinate(random) / 100.f });
+            if (i % 10 == 0) {
+                object->setActive(false);
+            }
+            objects.push_back(object);
+        }
+        manager.clearChanges();
+
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "KryptosBench";
+        std::filesystem::create_directories(directory);
+        const std::string binaryPath = (directory / "world.snapshot").string();
+        const std::string textPath = (directory / "world.txt").string();
+
+        printTitle("World snapshots of 100000 objects: WorldSnapshot vs naive text");
+        printTiming("binary, save", measure(2, 20, [&] {
+            KryptosEngine::WorldSnapshot::save(binaryPath);
+        }), ObjectCount);
+        printTiming("text, save", measure(2, 20, [&] {
+            saveText(textPath);
+        }), ObjectCount);
+
+        printTiming("binary, map and read every field", measure(2, 20, [&] {
+            const KryptosEngine::MappedSnapshot snapshot(binaryPath);
+            readSink = readMapped(snapshot);
+        }), ObjectCount);
+        std::vector<TextRecord> records;
+        printTiming("text, parse every field", measure(2, 20, [&] {
+            loadText(textPath, records);
+        }), ObjectCount);
+
+        printTiming("binary, map and restore", measure(2, 20, [&] {
+            const KryptosEngine::MappedSnapshot snapshot(binaryPath);
+            expectRestored(KryptosEngine::WorldSnapshot::restore(snapshot), "binary");
+        }), ObjectCount);
+        printTiming("text, parse and restore", measure(2, 20, [&] {
+            loadText(textPath, records);
+            expectRestored(restoreText(records), "text");
+        }), ObjectCount);
+
+        std::cout << "  file sizes: binary " << std::filesystem::file_size(binaryPath) / 1024 << " KiB, text "
+            << std::filesystem::file_size(textPath) / 1024 << " KiB" << std::endl;
+
+        manager.clearChanges();
+        for (GameObject* object : objects) {
+            manager.destroy(object);
+        }
+        std::filesystem::remove(binaryPath);
+        std::filesystem::remove(textPath);
+    }
+}
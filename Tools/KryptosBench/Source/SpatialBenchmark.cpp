@@ -0,0 +1,190 @@
+/*
+ * SpatialBenchmark.cpp - Kryptos Spatial Index Benchmark
+ * ------------------------------------------------------
+ * Times the UniformGridIndex and the LooseQuadtreeIndex through the
+ * SpatialIndex interface, the way the GameObjectManager drives them, with
+ * 100,000 objects in a 10,000 unit square world. Objects are spread evenly
+ * or packed into clusters, and move a short step each frame. Both indices
+ * answer the same queries, and their result counts are checked against
+ * each other.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Timing helpers.
+ *   - UniformGridIndex.h, LooseQuadtreeIndex.h: The indices being measured.
+ *   - iostream: For the result counts.
+ *   - random: For seeded, repeatable object and query positions.
+ *   - stdexcept: For reporting indices that disagree.
+ */
+
+#include "../Include/Benchmark.h"
+#include "../../../Engine/KryptosEngine/Include/SpatialSystem/UniformGridIndex.h"
+#include "../../../Engine/KryptosEngine/Include/SpatialSystem/LooseQuadtreeIndex.h"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::size_t ObjectCount = 100000;
+    constexpr std::size_t QueryCount = 1000;
+    constexpr float WorldSize = 10000.f;
+    constexpr float QueryRadius = 100.f;
+    constexpr std::size_t NearestCount = 8;
+
+    /**
+     * @brief Object positions and velocities, and the points queried each run.
+     */
+    struct Scene {
+        std::vector<sf::Vector2f> positions;   ///< Position of each object.
+        std::vector<sf::Vector2f> velocities;  ///< Distance each object moves per frame.
+        std::vector<sf::Vector2f> queries;     ///< Centre of each query.
+    };
+
+    /**
+     * @brief Total results of one run of each query, compared between the indices.
+     */
+    struct QueryTotals {
+        std::size_t aabb = 0;
+        std::size_t radius = 0;
+        std::size_t nearest = 0;
+    };
+
+    GameObjectHandle handleOf(std::size_t index) {
+        GameObjectHandle handle;
+        handle.index = static_cast<std::uint32_t>(index);
+        handle.generation = 1;
+        return handle;
+    }
+
+    /**
+     * @brief Builds a scene from a fixed seed.
+     * @param clustered Packs objects and queries around 50 centres instead of spreading them evenly.
+     */
+    Scene makeScene(bool clustered) {
+        std::mt19937 random(clustered ? 2u : 1u);
+        std::uniform_real_distribution<float> anywhere(0.f, WorldSize);
+        std::uniform_real_distribution<float> step(-2.f, 2.f);
+        std::normal_distribution<float> spread(0.f, 150.f);
+
+        std::vector<sf::Vector2f> centres;
+        for (std::size_t i = 0; i < 50; ++i) {
+            centres.push_back({ anywhere(random), anywhere(random) });
+        }
+        auto place = [&]() -> sf::Vector2f {
+            if (!clustered) {
+                return { anywhere(random), anywhere(random) };
+            }
+            const sf::Vector2f& centre = centres[random() % centres.size()];
+            return { centre.x + spread(random), centre.y + spread(random) };
+        };
+
+        Scene scene;
+        for (std::size_t i = 0; i < ObjectCount; ++i) {
+            scene.positions.push_back(place());
+            scene.velocities.push_back({ step(random), step(random) });
+        }
+        for (std::size_t i = 0; i < QueryCount; ++i) {
+            scene.queries.push_back(place());
+        }
+        return scene;
+    }
+
+    /**
+     * @brief Times building, updating and querying one index over a scene.
+     * @return Result totals of the last run of each query.
+     */
+    QueryTotals measureIndex(const std::string& label, KryptosEngine::SpatialIndex& index, Scene scene) {
+        const KryptosBench::Timing build = KryptosBench::measure(2, 20, [&] {
+            index.clear();
+            for (std::size_t i = 0; i < ObjectCount; ++i) {
+                index.insert(handleOf(i), scene.positions[i]);
+            }
+        });
+        KryptosBench::printTiming(label + ", insert all", build, ObjectCount);
+
+        const KryptosBench::Timing move = KryptosBench::measure(5, 50, [&] {
+            for (std::size_t i = 0; i < ObjectCount; ++i) {
+                sf::Vector2f& position = scene.positions[i];
+                sf::Vector2f& velocity = scene.velocities[i];
+                position += velocity;
+                if (position.x < 0.f || position.x > WorldSize) {
+                    velocity.x = -velocity.x;
+                }
+                if (position.y < 0.f || position.y > WorldSize) {
+                    velocity.y = -velocity.y;
+                }
+                index.update(handleOf(i), position);
+            }
+        });
+        KryptosBench::printTiming(label + ", move all", move, ObjectCount);
+
+        QueryTotals totals;
+        std::vector<GameObjectHandle> results;
+        const KryptosBench::Timing aabb = KryptosBench::measure(5, 50, [&] {
+            totals.aabb = 0;
+            for (const sf::Vector2f& centre : scene.queries) {
+                results.clear();
+                index.queryAABB(sf::FloatRect({ centre.x - QueryRadius, centre.y - QueryRadius },
+                    { 2.f * QueryRadius, 2.f * QueryRadius }), results);
+                totals.aabb += results.size();
+            }
+        });
+        KryptosBench::printTiming(label + ", queryAABB", aabb, QueryCount);
+
+        const KryptosBench::Timing radius = KryptosBench::measure(5, 50, [&] {
+            totals.radius = 0;
+            for (const sf::Vector2f& centre : scene.queries) {
+                results.clear();
+                index.queryRadius(centre, QueryRadius, results);
+                totals.radius += results.size();
+            }
+        });
+        KryptosBench::printTiming(label + ", queryRadius", radius, QueryCount);
+
+        const KryptosBench::Timing nearest = KryptosBench::measure(5, 50, [&] {
+            totals.nearest = 0;
+            for (const sf::Vector2f& centre : scene.queries) {
+                results.clear();
+                index.queryNearest(centre, NearestCount, results);
+                totals.nearest += results.size();
+            }
+        });
+        KryptosBench::printTiming(label + ", queryNearest", nearest, QueryCount);
+        return totals;
+    }
+
+    /**
+     * @brief Measures both indices over one scene and checks that they found the same objects.
+     */
+    void measureScene(const std::string& distribution, bool clustered) {
+        const Scene scene = makeScene(clustered);
+
+        KryptosEngine::UniformGridIndex grid(QueryRadius);
+        const QueryTotals gridTotals = measureIndex("grid, " + distribution, grid, scene);
+
+        KryptosEngine::LooseQuadtreeIndex quadtree(sf::FloatRect({ 0.f, 0.f }, { WorldSize, WorldSize }));
+        const QueryTotals quadtreeTotals = measureIndex("quadtree, " + distribution, quadtree, scene);
+
+        if (gridTotals.aabb != quadtreeTotals.aabb || gridTotals.radius != quadtreeTotals.radius
+            || gridTotals.nearest != quadtreeTotals.nearest) {
+            throw std::runtime_error("Spatial indices returned different results for the " + distribution + " scene");
+        }
+        std::cout << "  " << distribution << " results per query: queryAABB " << gridTotals.aabb / QueryCount
+            << ", queryRadius " << gridTotals.radius / QueryCount << ", queryNearest " << gridTotals.nearest / QueryCount << std::endl;
+    }
+}
+
+namespace KryptosBench {
+
+    void runSpatialBenchmark() {
+        printTitle("SpatialIndex: uniform grid vs loose quadtree, 100000 objects, 1000 queries per run");
+        measureScene("even", false);
+        measureScene("clustered", true);
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * SpriteBenchmark.cpp - Kryptos Sprite Drawing Benchmark
+ * ------------------------------------------------------
+ * Times drawing 10,000 and 100,000 sprites into an off-screen
+ * sf::RenderTexture, first with one draw call per sprite, as
+ * SpriteRenderer::draw does, then through a SpriteBatch. Sprites use eight
+ * small textures, packed by the TextureAtlas as the game's are, and are all
+ * placed on screen so the batch culls nothing.
+ *
+ * Each timed frame clears the target, draws, displays and waits for the
+ * GPU with glFinish, so the numbers include the driver's work rather than
+ * just the time to queue commands.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Timing helpers.
+ *   - SpriteBatch.h, SpriteRenderer.h: The drawing paths being measured.
+ *   - SFML/OpenGL.hpp: For glFinish.
+ *   - filesystem: For the generated textures.
+ *   - random: For seeded, repeatable sprite positions.
+ */
+
+#include "../Include/Benchmark.h"
+#include "../../../Engine/KryptosEngine/Include/SpriteRenderingSystem/SpriteBatch.h"
+#include "../../../Engine/KryptosEngine/Include/SpriteRenderingSystem/SpriteRenderer.h"
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr unsigned TargetWidth = 1920;
+    constexpr unsigned TargetHeight = 1080;
+    constexpr std::size_t TextureCount = 8;
+
+    /**
+     * @brief Writes the benchmark's textures to a temporary directory.
+     * @return Paths of the texture files.
+     */
+    std::vector<std::string> writeTextures() {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "KryptosBench";
+        std::filesystem::create_directories(directory);
+
+        std::vector<std::string> paths;
+        for (std::size_t i = 0; i < TextureCount; ++i) {
+            const auto shade = static_cast<std::uint8_t>(64 + 24 * i);
+            const sf::Image image({ 32u, 32u }, sf::Color(shade, 255 - shade, 128));
+            const std::filesystem::path path = directory / ("sprite" + std::to_string(i) + ".png");
+            if (!image.saveToFile(path)) {
+                throw std::runtime_error("Could not write benchmark texture " + path.string());
+            }
+            paths.push_back(path.string());
+        }
+        return paths;
+    }
+
+    /**
+     * @brief Creates sprites spread over the target, cycling through the textures.
+     */
+    std::vector<std::unique_ptr<SpriteRenderer>> createSprites(std::size_t count, const std::vector<std::string>& textures) {
+        std::mt19937 random(1u);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(TargetWidth - 32));
+        std::uniform_real_distribution<float> y(0.f, static_cast<float>(TargetHeight - 32));
+
+        std::vector<std::unique_ptr<SpriteRenderer>> sprites;
+        sprites.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto sprite = std::make_unique<SpriteRenderer>();
+            sprite->loadTexture(textures[i % textures.size()]);
+            if (!sprite->getSprite()) {
+                throw std::runtime_error("Could not load benchmark texture " + textures[i % textures.size()]);
+            }
+            sprite->setPosition({ x(random), y(random) });
+            sprites.push_back(std::move(sprite));
+        }
+        return sprites;
+    }
+
+    /**
+     * @brief Presents a frame and waits until the GPU has finished it.
+     */
+    void finishFrame(sf::RenderTexture& target) {
+        target.display();
+        if (!target.setActive(true)) {
+            throw std::runtime_error("Could not activate the benchmark render texture");
+        }
+        glFinish();
+    }
+
+    /**
+     * @brief Times both drawing paths for one sprite count.
+     */
+    void measureCount(sf::RenderTexture& target, std::size_t count, std::size_t runs, const std::vector<std::string>& textures) {
+        const std::vector<std::unique_ptr<SpriteRenderer>> sprites = createSprites(count, textures);
+        const std::string suffix = ", " + std::to_string(count) + " sprites";
+
+        const KryptosBench::Timing perSprite = KryptosBench::measure(5, runs, [&] {
+            target.clear();
+            for (const auto& sprite : sprites) {
+                target.draw(*sprite->getSprite());
+            }
+            finishFrame(target);
+        });
+        KryptosBench::printTiming("draw per sprite" + suffix, perSprite, count);
+
+        SpriteBatch batch;
+        const KryptosBench::Timing batched = KryptosBench::measure(5, runs, [&] {
+            target.clear();
+            batch.begin(target);
+            for (const auto& sprite : sprites) {
+                batch.add(*sprite);
+            }
+            batch.draw(target);
+            finishFrame(target);
+        });
+        KryptosBench::printTiming("SpriteBatch (draw calls: " + std::to_string(batch.getDrawCallCount()) + ")" + suffix,
+            batched, count);
+    }
+}
+
+namespace KryptosBench {
+
+    void runSpriteBenchmark() {
+        const std::vector<std::string> textures = writeTextures();
+        sf::RenderTexture target({ TargetWidth, TargetHeight });
+
+        printTitle("Sprites into a 1920x1080 RenderTexture: draw per sprite vs SpriteBatch");
+        measureCount(target, 10000, 100, textures);
+        measureCount(target, 100000, 20, textures);
+
+        SpriteRenderer::clearCache();
+    }
+}
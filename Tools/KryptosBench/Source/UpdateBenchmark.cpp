@@ -0,0 +1,138 @@
+/*
+ * UpdateBenchmark.cpp - Kryptos Update Dispatch Benchmark
+ * -------------------------------------------------------
+ * Times GameObjectManager::updateAll over objects of four types, created
+ * interleaved. In the mixed case the types are never registered, so every
+ * object sits in the generic bucket and is updated through a virtual call.
+ * In the bucketed case each type is registered with registerType, so its
+ * objects are updated by a devirtualized loop over their own bucket. The
+ * pooled case is bucketed too, but its objects are created with spawn, so
+ * each bucket also walks its type's pool in address order.
+ *
+ * Updates run on the calling thread, so the numbers compare dispatch and
+ * memory order rather than JobSystem scheduling.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - Benchmark.h: Timing helpers.
+ *   - GameObjectManager.h: The registry being measured.
+ */
+
+#include "../Include/Benchmark.h"
+#include "../../../Engine/KryptosEngine/Include/GameObjectSystem/GameObjectManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief How the objects of a case are stored and dispatched.
+     */
+    enum class Placement {
+        Mixed,     ///< Created with create, types unregistered: generic bucket, virtual calls.
+        Bucketed,  ///< Created with create, types registered: one bucket per type.
+        Pooled     ///< Created with spawn: one bucket and one pool per type.
+    };
+
+    /**
+     * @brief Object with a small per-frame timer, standing in for typical gameplay logic.
+     * @tparam Kind Distinguishes the four types of a case.
+     * @tparam Case Placement of the case, so each case has its own types.
+     */
+    template <int Kind, Placement Case>
+    class TickingObject : public GameObject {
+    private:
+        float timer = 0.f;
+        std::uint32_t ticks = 0;
+
+    public:
+        TickingObject()
+            : GameObject("bench", { 0.f, 0.f }, true, sf::radians(0.f), 1.f, false) {
+        }
+
+        void update(float deltaTime) override {
+            timer += deltaTime * static_cast<float>(Kind + 1);
+            if (timer >= 1.f) {
+                timer -= 1.f;
+                ++ticks;
+            }
+        }
+    };
+
+    /**
+     * @brief Creates one object of a case.
+     */
+    template <int Kind, Placement Case>
+    GameObject* createObject() {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        if constexpr (Case == Placement::Pooled) {
+            return manager.spawn<TickingObject<Kind, Case>>();
+        }
+        else {
+            return manager.create<TickingObject<Kind, Case>>();
+        }
+    }
+
+    /**
+     * @brief Creates objects of the four types of a case, one of each in turn.
+     */
+    template <Placement Case>
+    std::vector<GameObject*> createObjects(std::size_t count) {
+        std::vector<GameObject*> objects;
+        objects.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (i % 4) {
+            case 0: objects.push_back(createObject<0, Case>()); break;
+            case 1: objects.push_back(createObject<1, Case>()); break;
+            case 2: objects.push_back(createObject<2, Case>()); break;
+            default: objects.push_back(createObject<3, Case>()); break;
+            }
+        }
+        return objects;
+    }
+
+    /**
+     * @brief Times updateAll over count objects of one case.
+     */
+    template <Placement Case>
+    void measureCase(const char* label, std::size_t count, std::size_t runs) {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        std::vector<GameObject*> objects = createObjects<Case>(count);
+        manager.clearChanges();
+
+        const KryptosBench::Timing timing = KryptosBench::measure(10, runs, [&manager] {
+            manager.updateAll(1.f / 60.f);
+        });
+        KryptosBench::printTiming(label + std::string(", ") + std::to_string(count) + " objects", timing, count);
+
+        for (GameObject* object : objects) {
+            manager.destroy(object);
+        }
+    }
+}
+
+namespace KryptosBench {
+
+    void runUpdateBenchmark() {
+        GameObjectManager& manager = GameObjectManager::getInstance();
+        manager.setParallelUpdates(false);
+        manager.registerType<TickingObject<0, Placement::Bucketed>>();
+        manager.registerType<TickingObject<1, Placement::Bucketed>>();
+        manager.registerType<TickingObject<2, Placement::Bucketed>>();
+        manager.registerType<TickingObject<3, Placement::Bucketed>>();
+
+        printTitle("updateAll: mixed types with virtual dispatch vs per-type buckets");
+        const std::size_t counts[] = { 1000, 10000, 100000 };
+        const std::size_t runs[] = { 2000, 500, 100 };
+        for (std::size_t i = 0; i < 3; ++i) {
+            measureCase<Placement::Mixed>("mixed", counts[i], runs[i]);
+            measureCase<Placement::Bucketed>("bucketed", counts[i], runs[i]);
+            measureCase<Placement::Pooled>("bucketed, pooled", counts[i], runs[i]);
+        }
+
+        manager.setParallelUpdates(true);
+    }
+}
@@ -0,0 +1,61 @@
+#include "../Include/Benchmark.h"
+#include <exception>
+#include <iostream>
+#include <string>
+
+namespace {
+    /**
+     * @brief A benchmark selectable from the command line.
+     */
+    struct BenchmarkEntry {
+        const char* name;  ///< Name given on the command line.
+        void (*run)();     ///< Runs the benchmark and prints its results.
+    };
+
+    const BenchmarkEntry benchmarks[] = {
+        { "update", &KryptosBench::runUpdateBenchmark },
+        { "spatial", &KryptosBench::runSpatialBenchmark },
+        { "sprites", &KryptosBench::runSpriteBenchmark },
+        { "snapshot", &KryptosBench::runSnapshotBenchmark },
+        { "history", &KryptosBench::runHistoryBenchmark },
+    };
+
+    /**
+     * @brief Prints the command line usage.
+     */
+    void printUsage() {
+        std::cerr << "Usage: KryptosBench <all";
+        for (const BenchmarkEntry& benchmark : benchmarks) {
+            std::cerr << '|' << benchmark.name;
+        }
+        std::cerr << ">" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    try {
+        const std::string selected = argv[1];
+        bool found = false;
+        for (const BenchmarkEntry& benchmark : benchmarks) {
+            if (selected == "all" || selected == benchmark.name) {
+                benchmark.run();
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "Unknown benchmark: " << selected << std::endl;
+            printUsage();
+            return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * AtlasBaker.h - Kryptos Offline Atlas Baker
+ * ------------------------------------------
+ * Defines the AtlasBaker, which packs a directory of PNG images into atlas
+ * page images and writes a binary manifest locating every sprite, so the
+ * game loads a few prepacked pages instead of decoding and packing each
+ * image at launch.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - string, cstddef: For settings and results.
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace KryptosTools {
+
+    /**
+     * @brief Settings of one bake.
+     */
+    struct AtlasBakeSettings {
+        std::string inputDirectory;   ///< Directory searched recursively for .png files.
+        std::string outputDirectory;  ///< Directory receiving the manifest and page images.
+        std::string atlasName = "atlas"; ///< Base name of the manifest and page files.
+        unsigned pageSize = 2048;     ///< Width and height of a page, in pixels.
+        unsigned threadCount = 0;     ///< Worker threads; 0 uses one per hardware thread.
+        bool force = false;           ///< Rebakes every page, ignoring the previous manifest.
+    };
+
+    /**
+     * @brief Outcome of one bake.
+     */
+    struct AtlasBakeResult {
+        std::size_t spriteCount = 0;   ///< Sprites in the manifest.
+        std::size_t pageCount = 0;     ///< Pages in the manifest.
+        std::size_t pagesWritten = 0;  ///< Page images encoded by this bake; unchanged pages are kept.
+        bool upToDate = false;         ///< True if nothing was baked because no input changed.
+    };
+
+    /**
+     * @class AtlasBaker
+     * @brief Packs PNG images into atlas pages with a binary manifest.
+     *
+     * Every input file is read and hashed, and the hash of all names and contents is compared
+     * with the one stored in the existing manifest, so a bake with unchanged inputs only reads
+     * files. Otherwise the inputs are packed largest first with the engine's SkylinePacker. An
+     * input whose hash matches its sprite in the previous manifest is packed with the recorded
+     * size, and only new or changed inputs are decoded before packing. A page whose sprites and
+     * rectangles match the previous bake keeps its existing image file; the remaining pages
+     * decode whatever of their inputs is still undecoded, then are composed and encoded in parallel.
+     *
+     * Sprites are named by their path relative to the input directory, with forward slashes
+     * and without the extension, such as "Player/Idle".
+     */
+    class AtlasBaker {
+    public:
+        /**
+         * @brief Runs a bake.
+         * @param settings The bake settings.
+         * @return What was baked.
+         * @throw std::runtime_error if an input cannot be read or decoded or an output cannot be written.
+         */
+        static AtlasBakeResult bake(const AtlasBakeSettings& settings);
+    };
+
+} // namespace KryptosTools
@@ -0,0 +1,529 @@
+/*
+ * AtlasBaker.cpp - Kryptos Offline Atlas Baker Implementation
+ * -----------------------------------------------------------
+ * Implements input hashing, reuse of the previous bake's sprite records,
+ * parallel decoding, packing, page composition and manifest writing for
+ * the AtlasBaker.
+ *
+ * Author: Sam Camilleri, Mural Studios
+ * All Rights Reserved, 2025.
+ *
+ * Dependencies:
+ *   - AtlasBaker.h: Header for the AtlasBaker class.
+ *   - SkylinePacker.h: The engine's rectangle packer, so baked and runtime pages pack alike.
+ *   - AtlasManifestFormat.h: Layout of the manifest file.
+ *   - SFML/Graphics/Image.hpp: For decoding, composing and encoding PNG images.
+ *   - filesystem, fstream: For finding inputs and writing outputs.
+ *   - thread, atomic, mutex: For the worker threads.
+ */
+
+#include "../Include/AtlasBaker.h"
+#include "../../../Engine/KryptosEngine/Include/SpriteRenderingSystem/SkylinePacker.h"
+#include "../../../Engine/KryptosEngine/Include/SpriteRenderingSystem/AtlasManifestFormat.h"
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace KryptosTools {
+
+    namespace {
+        namespace fs = std::filesystem;
+        using namespace KryptosEngine;
+
+        /**
+         * Gap left to the right of and below each image, in pixels. Matches the runtime atlas.
+         */
+        constexpr unsigned Padding = 1;
+
+        /**
+         * FNV-1a parameters.
+         */
+        constexpr std::uint64_t FnvOffset = 14695981039346656037ull;
+        constexpr std::uint64_t FnvPrime = 1099511628211ull;
+
+        /**
+         * Extension of the manifest file.
+         */
+        constexpr const char* ManifestExtension = ".katlas";
+
+        /**
+         * @brief Continues an FNV-1a hash over a run of bytes.
+         */
+        std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t hash = FnvOffset) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * FnvPrime;
+            }
+            return hash;
+        }
+
+        /**
+         * @brief Continues an FNV-1a hash over a value's bytes.
+         */
+        template <typename T>
+        std::uint64_t hashValue(const T& value, std::uint64_t hash) {
+            static_assert(std::is_trivially_copyable_v<T>, "only plain values can be hashed by their bytes");
+            return hashBytes(&value, sizeof(value), hash);
+        }
+
+        /**
+         * @brief Continues an FNV-1a hash over a string and its length.
+         */
+        std::uint64_t hashString(const std::string& value, std::uint64_t hash) {
+            hash = hashValue(static_cast<std::uint64_t>(value.size()), hash);
+            return hashBytes(value.data(), value.size(), hash);
+        }
+
+        /**
+         * @brief A source image and where it was packed.
+         */
+        struct Input {
+            std::string name;                  ///< Sprite name.
+            fs::path path;                     ///< Source file.
+            std::vector<char> bytes;           ///< File contents, until decoded.
+            std::uint64_t hash = 0;            ///< Hash of the file contents.
+            sf::Vector2u size;                 ///< Image size, from the previous bake or from decoding.
+            bool decoded = false;              ///< True once image holds the decoded file.
+            sf::Image image;                   ///< Decoded image, only for inputs on pages being encoded.
+            std::uint32_t page = 0;            ///< Page the image was packed on.
+            SkylinePacker::Placement placement{}; ///< Position on the page.
+        };
+
+        /**
+         * @brief A page being built.
+         */
+        struct Page {
+            unsigned width;                         ///< Width, in pixels.
+            unsigned height;                        ///< Height, in pixels.
+            std::unique_ptr<SkylinePacker> packer;  ///< Free space, or nullptr for a page holding one oversized image.
+            std::vector<std::size_t> inputs;        ///< Inputs placed on the page, in placement order.
+            std::string fileName;                   ///< Image file name.
+            std::uint64_t contentHash = 0;          ///< Hash of the placed inputs and their rectangles.
+        };
+
+        /**
+         * @brief A sprite of the previous bake.
+         */
+        struct PreviousSprite {
+            std::uint64_t sourceHash;  ///< Hash of the source file it was baked from.
+            sf::Vector2u size;         ///< Size of the image, in pixels.
+        };
+
+        /**
+         * @brief What the previous bake left in the output directory.
+         */
+        struct PreviousBake {
+            bool valid = false;                                          ///< True if a readable manifest was found.
+            std::uint64_t inputHash = 0;                                 ///< Input hash of the previous bake.
+            std::unordered_map<std::string, std::uint64_t> pages;        ///< Content hash of each page file.
+            std::unordered_map<std::string, PreviousSprite> sprites;     ///< Sprites by name.
+        };
+
+        /**
+         * @brief Runs a function for every index below a count on worker threads.
+         *
+         * The first exception thrown stops the remaining work and is rethrown on the calling thread.
+         */
+        void parallelFor(std::size_t count, unsigned threadCount, const std::function<void(std::size_t)>& body) {
+            std::atomic<std::size_t> next{ 0 };
+            std::exception_ptr failure;
+            std::mutex failureMutex;
+
+            const auto work = [&]() {
+                for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                    try {
+                        body(i);
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> lock(failureMutex);
+                        if (!failure) {
+                            failure = std::current_exception();
+                        }
+                        next.store(count);
+                    }
+                }
+                };
+
+            std::vector<std::thread> workers;
+            const std::size_t workerCount = std::min<std::size_t>(threadCount, count);
+            for (std::size_t i = 1; i < workerCount; ++i) {
+                workers.emplace_back(work);
+            }
+            work();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+
+        /**
+         * @brief Reads a whole file.
+         * @throw std::runtime_error if the file cannot be read.
+         */
+        std::vector<char> readFile(const fs::path& path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) {
+                throw std::runtime_error("Failed to open " + path.string());
+            }
+            std::vector<char> bytes(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0);
+            if (!file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+                throw std::runtime_error("Failed to read " + path.string());
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Reads the manifest of the previous bake, if there is a valid one.
+         */
+        PreviousBake readPreviousBake(const fs::path& manifestPath) {
+            PreviousBake previous;
+            std::error_code error;
+            if (!fs::is_regular_file(manifestPath, error)) {
+                return previous;
+            }
+
+            std::vector<char> bytes;
+            try {
+                bytes = readFile(manifestPath);
+            }
+            catch (const std::runtime_error&) {
+                return previous;
+            }
+
+            AtlasManifestHeader header;
+            if (bytes.size() < sizeof(header)) {
+                return previous;
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            if (std::memcmp(header.magic, AtlasManifestMagic, sizeof(header.magic)) != 0 ||
+                header.version != AtlasManifestVersion || header.byteOrder != AtlasManifestByteOrder ||
+                header.fileSize != bytes.size() || header.pages > bytes.size() ||
+                header.pageCount > (bytes.size() - header.pages) / sizeof(AtlasManifestPage) ||
+                header.sprites > bytes.size() ||
+                header.spriteCount > (bytes.size() - header.sprites) / sizeof(AtlasManifestSprite) ||
+                header.stringData > bytes.size()) {
+                return previous;
+            }
+
+            for (std::uint32_t i = 0; i < header.pageCount; ++i) {
+                AtlasManifestPage page;
+                std::memcpy(&page, bytes.data() + header.pages + i * sizeof(page), sizeof(page));
+                if (page.fileName + static_cast<std::uint64_t>(page.fileNameLength) > bytes.size() - header.stringData) {
+                    return previous;
+                }
+                previous.pages.emplace(std::string(bytes.data() + header.stringData + page.fileName, page.fileNameLength), page.contentHash);
+            }
+
+            for (std::uint32_t i = 0; i < header.spriteCount; ++i) {
+                AtlasManifestSprite sprite;
+                std::memcpy(&sprite, bytes.data() + header.sprites + i * sizeof(sprite), sizeof(sprite));
+                if (sprite.name + static_cast<std::uint64_t>(sprite.nameLength) > bytes.size() - header.stringData) {
+                    return PreviousBake();
+                }
+                previous.sprites.emplace(std::string(bytes.data() + header.stringData + sprite.name, sprite.nameLength),
+                    PreviousSprite{ sprite.sourceHash, sf::Vector2u(sprite.width, sprite.height) });
+            }
+            previous.valid = true;
+            previous.inputHash = header.inputHash;
+            return previous;
+        }
+
+        /**
+         * @brief Rounds a byte offset up to a multiple of eight.
+         */
+        std::size_t align8(std::size_t offset) {
+            return (offset + 7) & ~static_cast<std::size_t>(7);
+        }
+
+        /**
+         * @brief Writes the manifest for the packed inputs.
+         * @throw std::runtime_error if the file cannot be written.
+         */
+        void writeManifest(const fs::path& path, std::uint64_t inputHash, const std::vector<Input>& inputs, const std::vector<Page>& pages) {
+            std::string strings;
+            std::vector<AtlasManifestPage> pageRecords;
+            for (const Page& page : pages) {
+                pageRecords.push_back({ static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(page.fileName.size()),
+                    page.width, page.height, page.contentHash });
+                strings += page.fileName;
+            }
+
+            // Sorted by name so the runtime can binary-search sprites
+            std::vector<std::size_t> order(inputs.size());
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&inputs](std::size_t a, std::size_t b) {
+                return inputs[a].name < inputs[b].name;
+                });
+
+            std::vector<AtlasManifestSprite> spriteRecords;
+            for (std::size_t index : order) {
+                const Input& input = inputs[index];
+                spriteRecords.push_back({ static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(input.name.size()),
+                    input.page, input.placement.x, input.placement.y, input.size.x, input.size.y, 0, input.hash });
+                strings += input.name;
+            }
+
+            AtlasManifestHeader header{};
+            std::memcpy(header.magic, AtlasManifestMagic, sizeof(header.magic));
+            header.version = AtlasManifestVersion;
+            header.byteOrder = AtlasManifestByteOrder;
+            header.inputHash = inputHash;
+            header.pageCount = static_cast<std::uint32_t>(pageRecords.size());
+            header.spriteCount = static_cast<std::uint32_t>(spriteRecords.size());
+            header.pages = align8(sizeof(header));
+            header.sprites = align8(header.pages + pageRecords.size() * sizeof(AtlasManifestPage));
+            header.stringData = header.sprites + spriteRecords.size() * sizeof(AtlasManifestSprite);
+            header.fileSize = header.stringData + strings.size();
+
+            std::vector<char> buffer(static_cast<std::size_t>(header.fileSize), 0);
+            std::memcpy(buffer.data(), &header, sizeof(header));
+            if (!pageRecords.empty()) {
+                std::memcpy(buffer.data() + header.pages, pageRecords.data(), pageRecords.size() * sizeof(AtlasManifestPage));
+            }
+            if (!spriteRecords.empty()) {
+                std::memcpy(buffer.data() + header.sprites, spriteRecords.data(), spriteRecords.size() * sizeof(AtlasManifestSprite));
+            }
+            std::memcpy(buffer.data() + header.stringData, strings.data(), strings.size());
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            if (!file) {
+                throw std::runtime_error("Failed to write manifest: " + path.string());
+            }
+        }
+    }
+
+    /**
+     * @brief Runs a bake.
+     *
+     * Reading and hashing, decoding, and page composition each run on the worker threads.
+     * Packing itself is sequential and ordered, so the same inputs always give the same pages.
+     * An input whose hash matches its sprite record in the previous manifest is packed with the
+     * recorded size and is only decoded if its page has to be encoded again.
+     * @param settings The bake settings.
+     * @return What was baked.
+     * @throw std::runtime_error if an input cannot be read or decoded or an output cannot be written.
+     */
+    AtlasBakeResult AtlasBaker::bake(const AtlasBakeSettings& settings) {
+        const fs::path inputDirectory(settings.inputDirectory);
+        const fs::path outputDirectory(settings.outputDirectory);
+        if (!fs::is_directory(inputDirectory)) {
+            throw std::runtime_error("Input directory not found: " + settings.inputDirectory);
+        }
+        if (settings.pageSize <= Padding) {
+            throw std::runtime_error("Page size must be larger than the padding");
+        }
+        fs::create_directories(outputDirectory);
+        const unsigned threadCount = settings.threadCount != 0 ? settings.threadCount : std::max(1u, std::thread::hardware_concurrency());
+
+        // Find the inputs, in name order so the bake does not depend on directory order
+        std::vector<Input> inputs;
+        for (const fs::directory_entry& entry : fs::recursive_directory_iterator(inputDirectory)) {
+            if (!entry.is_regular_file()) {
+                continue;
+            }
+            std::string extension = entry.path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+                });
+            if (extension != ".png") {
+                continue;
+            }
+
+            Input& input = inputs.emplace_back();
+            input.path = entry.path();
+            input.name = fs::relative(entry.path(), inputDirectory).replace_extension().generic_string();
+        }
+        std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) {
+            return a.name < b.name;
+            });
+
+        parallelFor(inputs.size(), threadCount, [&inputs](std::size_t i) {
+            inputs[i].bytes = readFile(inputs[i].path);
+            inputs[i].hash = hashBytes(inputs[i].bytes.data(), inputs[i].bytes.size());
+            });
+
+        std::uint64_t inputHash = hashValue(AtlasManifestVersion, FnvOffset);
+        inputHash = hashValue(settings.pageSize, inputHash);
+        inputHash = hashValue(Padding, inputHash);
+        inputHash = hashString(settings.atlasName, inputHash);
+        for (const Input& input : inputs) {
+            inputHash = hashString(input.name, inputHash);
+            inputHash = hashValue(input.hash, inputHash);
+        }
+
+        const fs::path manifestPath = outputDirectory / (settings.atlasName + ManifestExtension);
+        const PreviousBake previous = readPreviousBake(manifestPath);
+        if (!settings.force && previous.valid && previous.inputHash == inputHash) {
+            const bool pagesPresent = std::all_of(previous.pages.begin(), previous.pages.end(), [&outputDirectory](const auto& page) {
+                return fs::is_regular_file(outputDirectory / page.first);
+                });
+            if (pagesPresent) {
+                AtlasBakeResult result;
+                result.spriteCount = previous.sprites.size();
+                result.pageCount = previous.pages.size();
+                result.upToDate = true;
+                return result;
+            }
+        }
+
+        const auto decode = [&inputs](std::size_t i) {
+            Input& input = inputs[i];
+            if (!input.image.loadFromMemory(input.bytes.data(), input.bytes.size())) {
+                throw std::runtime_error("Failed to decode " + input.path.string());
+            }
+            if (input.size != sf::Vector2u() && input.size != input.image.getSize()) {
+                throw std::runtime_error("Size of " + input.name + " differs from the previous manifest; rebake with --force");
+            }
+            input.size = input.image.getSize();
+            input.decoded = true;
+            std::vector<char>().swap(input.bytes);
+            };
+
+        // Unchanged inputs take their size from the previous manifest; the rest must be decoded to be packed
+        std::vector<std::size_t> toDecode;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            const auto old = settings.force ? previous.sprites.end() : previous.sprites.find(inputs[i].name);
+            if (old != previous.sprites.end() && old->second.sourceHash == inputs[i].hash) {
+                inputs[i].size = old->second.size;
+            }
+            else {
+                toDecode.push_back(i);
+            }
+        }
+        parallelFor(toDecode.size(), threadCount, [&](std::size_t i) {
+            decode(toDecode[i]);
+            });
+
+        // Pack tallest first, which suits a skyline packer best
+        std::vector<std::size_t> packOrder(inputs.size());
+        for (std::size_t i = 0; i < packOrder.size(); ++i) {
+            packOrder[i] = i;
+        }
+        std::stable_sort(packOrder.begin(), packOrder.end(), [&inputs](std::size_t a, std::size_t b) {
+            const sf::Vector2u sizeA = inputs[a].size;
+            const sf::Vector2u sizeB = inputs[b].size;
+            return sizeA.y != sizeB.y ? sizeA.y > sizeB.y : sizeA.x > sizeB.x;
+            });
+
+        std::vector<Page> pages;
+        for (std::size_t index : packOrder) {
+            Input& input = inputs[index];
+            const sf::Vector2u size = input.size;
+
+            Page* target = nullptr;
+            if (size.x + Padding > settings.pageSize || size.y + Padding > settings.pageSize) {
+                target = &pages.emplace_back(Page{ size.x, size.y, nullptr, {}, {}, 0 });
+                input.placement = { 0, 0 };
+            }
+            else {
+                for (Page& page : pages) {
+                    if (page.packer && page.packer->insert(size.x + Padding, size.y + Padding, input.placement)) {
+                        target = &page;
+                        break;
+                    }
+                }
+                if (target == nullptr) {
+                    target = &pages.emplace_back(Page{ settings.pageSize, settings.pageSize,
+                        std::make_unique<SkylinePacker>(settings.pageSize, settings.pageSize), {}, {}, 0 });
+                    target->packer->insert(size.x + Padding, size.y + Padding, input.placement);
+                }
+            }
+            input.page = static_cast<std::uint32_t>(target - pages.data());
+            target->inputs.push_back(index);
+        }
+
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            Page& page = pages[i];
+            page.fileName = settings.atlasName + "_" + std::to_string(i) + ".png";
+            std::uint64_t hash = hashValue(page.width, FnvOffset);
+            hash = hashValue(page.height, hash);
+            for (std::size_t index : page.inputs) {
+                const Input& input = inputs[index];
+                hash = hashString(input.name, hash);
+                hash = hashValue(input.hash, hash);
+                hash = hashValue(input.placement.x, hash);
+                hash = hashValue(input.placement.y, hash);
+            }
+            page.contentHash = hash;
+        }
+
+        // Only pages whose content changed are encoded, so only their inputs need decoding
+        std::vector<std::size_t> pagesToWrite;
+        toDecode.clear();
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            const Page& page = pages[i];
+            const auto old = previous.pages.find(page.fileName);
+            if (!settings.force && old != previous.pages.end() && old->second == page.contentHash &&
+                fs::is_regular_file(outputDirectory / page.fileName)) {
+                continue;
+            }
+            pagesToWrite.push_back(i);
+            for (std::size_t index : page.inputs) {
+                if (!inputs[index].decoded) {
+                    toDecode.push_back(index);
+                }
+            }
+        }
+        parallelFor(toDecode.size(), threadCount, [&](std::size_t i) {
+            decode(toDecode[i]);
+            });
+        for (Input& input : inputs) {
+            std::vector<char>().swap(input.bytes);
+        }
+
+        parallelFor(pagesToWrite.size(), threadCount, [&](std::size_t i) {
+            const Page& page = pages[pagesToWrite[i]];
+            const fs::path pagePath = outputDirectory / page.fileName;
+
+            sf::Image image(sf::Vector2u(page.width, page.height), sf::Color::Transparent);
+            for (std::size_t index : page.inputs) {
+                const Input& input = inputs[index];
+                if (!image.copy(input.image, sf::Vector2u(input.placement.x, input.placement.y))) {
+                    throw std::runtime_error("Failed to place " + input.name + " on " + page.fileName);
+                }
+            }
+            if (!image.saveToFile(pagePath)) {
+                throw std::runtime_error("Failed to write page: " + pagePath.string());
+            }
+            });
+
+        writeManifest(manifestPath, inputHash, inputs, pages);
+
+        // Remove pages of the previous bake that no longer exist
+        for (const auto& page : previous.pages) {
+            const bool kept = std::any_of(pages.begin(), pages.end(), [&page](const Page& current) {
+                return current.fileName == page.first;
+                });
+            if (!kept) {
+                std::error_code error;
+                fs::remove(outputDirectory / page.first, error);
+            }
+        }
+
+        AtlasBakeResult result;
+        result.spriteCount = inputs.size();
+        result.pageCount = pages.size();
+        result.pagesWritten = pagesToWrite.size();
+        return result;
+    }
+
+} // namespace KryptosTools
@@ -0,0 +1,95 @@
+#include "../Include/AtlasBaker.h"
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /**
+     * @brief Prints the command line usage.
+     */
+    void printUsage() {
+        std::cerr << "Usage: KryptosTools bake-atlas <inputDir> <outputDir> [--name <name>] [--page-size <pixels>] [--threads <count>] [--force]" << std::endl;
+    }
+
+    /**
+     * @brief Parses a positive number argument.
+     * @throw std::invalid_argument if the argument is not a positive number.
+     */
+    unsigned parseCount(const std::string& option, const std::string& value) {
+        char* end = nullptr;
+        const unsigned long count = std::strtoul(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || count == 0) {
+            throw std::invalid_argument(option + " expects a positive number, got \"" + value + "\"");
+        }
+        return static_cast<unsigned>(count);
+    }
+
+    /**
+     * @brief Runs the bake-atlas command.
+     * @return The process exit code.
+     */
+    int bakeAtlas(int argc, char* argv[]) {
+        if (argc < 4) {
+            printUsage();
+            return 1;
+        }
+
+        KryptosTools::AtlasBakeSettings settings;
+        settings.inputDirectory = argv[2];
+        settings.outputDirectory = argv[3];
+        for (int i = 4; i < argc; ++i) {
+            const std::string option = argv[i];
+            if (option == "--force") {
+                settings.force = true;
+            }
+            else if (i + 1 < argc && option == "--name") {
+                settings.atlasName = argv[++i];
+            }
+            else if (i + 1 < argc && option == "--page-size") {
+                settings.pageSize = parseCount(option, argv[++i]);
+            }
+            else if (i + 1 < argc && option == "--threads") {
+                settings.threadCount = parseCount(option, argv[++i]);
+            }
+            else {
+                std::cerr << "Unknown option: " << option << std::endl;
+                printUsage();
+                return 1;
+            }
+        }
+
+        const KryptosTools::AtlasBakeResult result = KryptosTools::AtlasBaker::bake(settings);
+        if (result.upToDate) {
+            std::cout << "Atlas \"" << settings.atlasName << "\" is up to date: "
+                << result.spriteCount << " sprites on " << result.pageCount << " pages" << std::endl;
+        }
+        else {
+            std::cout << "Baked atlas \"" << settings.atlasName << "\": " << result.spriteCount << " sprites on "
+                << result.pageCount << " pages, " << result.pagesWritten << " pages written" << std::endl;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    try {
+        const std::string command = argv[1];
+        if (command == "bake-atlas") {
+            return bakeAtlas(argc, argv);
+        }
+        std::cerr << "Unknown command: " << command << std::endl;
+        printUsage();
+        return 1;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+}